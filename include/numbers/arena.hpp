@@ -0,0 +1,268 @@
+#ifndef NUMBERS_ARENA_HH
+#define NUMBERS_ARENA_HH
+
+#include "dynamic.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace numbers {
+namespace impl {
+
+/*
+ * arena_block_bytes (Size of each block a limb_arena carves allocations from)
+ */
+struct arena_block_bytes : identity<std::size_t, 64 * 1024> {};
+
+} //namespace impl
+
+/*
+ * limb_arena (Bump allocator for limb buffers, released all at once)
+ *
+ * Allocations are carved from a list of blocks by advancing an offset.
+ * Freeing the most recent allocation rewinds the offset; any other free is
+ * deferred until the arena is rewound. Blocks are kept on rewind, so a
+ * batch that repeats the same computation stops allocating after the first
+ * pass. Multiplication and division also take their scratch limbs from a
+ * single buffer per arena that only ever grows.
+ */
+class limb_arena {
+public:
+    /*
+     * mark (A position in the arena to rewind to)
+     */
+    struct mark {
+        std::size_t block;
+        std::size_t offset;
+    };
+
+    explicit limb_arena(std::size_t size = impl::arena_block_bytes::value) :
+        block_bytes(size)
+    {}
+
+    limb_arena(const limb_arena&) = delete;
+    limb_arena& operator=(const limb_arena&) = delete;
+
+    ~limb_arena() {
+        for (const block& b : blocks) {
+            ::operator delete(b.data);
+        }
+        ::operator delete(scratch_data);
+    }
+
+    /*
+     * allocate (bytes aligned to alignment, a power of two no larger than the default new alignment)
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment) {
+        while (current < blocks.size()) {
+            const std::size_t start = (offset + alignment - 1) & ~(alignment - 1);
+            if (start + bytes <= blocks[current].size) {
+                offset = start + bytes;
+                return blocks[current].data + start;
+            }
+            if (current + 1 == blocks.size()) {
+                break;
+            }
+            ++current;
+            offset = 0;
+        }
+        const std::size_t size = std::max(block_bytes, bytes);
+        blocks.push_back({ static_cast<char*>(::operator new(size)), size });
+        current = blocks.size() - 1;
+        offset = bytes;
+        return blocks[current].data;
+    }
+
+    /*
+     * deallocate (Rewinds over p when it is the most recent allocation)
+     */
+    void deallocate(void* p, std::size_t bytes) noexcept {
+        if (current < blocks.size() && static_cast<char*>(p) + bytes == blocks[current].data + offset) {
+            offset = static_cast<std::size_t>(static_cast<char*>(p) - blocks[current].data);
+        }
+    }
+
+    /*
+     * scratch (The arena's scratch buffer, grown to at least bytes; contents are not kept)
+     *
+     * There is one buffer per arena, and growing it frees the old one, so a
+     * pointer from an earlier call is only valid until the next. It must not
+     * be called while a limb_scratch holds the buffer.
+     */
+    void* scratch(std::size_t bytes) {
+        assert(!scratch_held && "limb_arena scratch is already held by a limb_scratch");
+        if (bytes > scratch_bytes) {
+            const std::size_t grown = std::max(bytes, 2 * scratch_bytes);
+            void* buffer = ::operator new(grown);
+            ::operator delete(scratch_data);
+            scratch_data = buffer;
+            scratch_bytes = grown;
+        }
+        return scratch_data;
+    }
+
+    /*
+     * acquire_scratch and release_scratch (scratch for a single holder, checked in debug builds)
+     */
+    void* acquire_scratch(std::size_t bytes) {
+        void* buffer = scratch(bytes);
+        scratch_held = true;
+        return buffer;
+    }
+
+    void release_scratch() noexcept {
+        scratch_held = false;
+    }
+
+    mark position() const noexcept {
+        return { current, offset };
+    }
+
+    /*
+     * rewind (Frees everything allocated after m, keeping the blocks)
+     */
+    void rewind(mark m) noexcept {
+        current = m.block;
+        offset = m.offset;
+    }
+
+    /*
+     * release (Frees every allocation, keeping the blocks)
+     */
+    void release() noexcept {
+        rewind({ 0, 0 });
+    }
+
+    /*
+     * reserved (Bytes held in blocks, whether in use or not)
+     */
+    std::size_t reserved() const noexcept {
+        std::size_t total = 0;
+        for (const block& b : blocks) {
+            total += b.size;
+        }
+        return total;
+    }
+
+private:
+    struct block {
+        char* data;
+        std::size_t size;
+    };
+
+    std::size_t block_bytes;
+    std::vector<block> blocks;
+    std::size_t current = 0;
+    std::size_t offset = 0;
+    void* scratch_data = nullptr;
+    std::size_t scratch_bytes = 0;
+    bool scratch_held = false;
+};
+
+/*
+ * arena_scope (Rewinds an arena on scope exit, freeing every temporary made inside at once)
+ *
+ * Values allocated from the arena inside the scope must not outlive it.
+ */
+class arena_scope {
+public:
+    explicit arena_scope(limb_arena& target) noexcept :
+        arena(target),
+        start(target.position())
+    {}
+
+    arena_scope(const arena_scope&) = delete;
+    arena_scope& operator=(const arena_scope&) = delete;
+
+    ~arena_scope() {
+        arena.rewind(start);
+    }
+
+private:
+    limb_arena& arena;
+    limb_arena::mark start;
+};
+
+/*
+ * arena_allocator (Standard allocator over a limb_arena)
+ */
+template<typename T>
+struct arena_allocator {
+    typedef T value_type;
+
+    limb_arena* arena;
+
+    explicit arena_allocator(limb_arena& source) noexcept :
+        arena(&source)
+    {}
+
+    template<typename U>
+    arena_allocator(const arena_allocator<U>& other) noexcept :
+        arena(other.arena)
+    {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        arena->deallocate(p, n * sizeof(T));
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const arena_allocator<T>& a, const arena_allocator<U>& b) {
+    return a.arena == b.arena;
+}
+
+template<typename T, typename U>
+bool operator!=(const arena_allocator<T>& a, const arena_allocator<U>& b) {
+    return a.arena != b.arena;
+}
+
+/*
+ * arena_bigint (dynamic_bigint with its limbs in a limb_arena)
+ */
+template<typename T = std::uint32_t>
+using arena_bigint = dynamic_bigint<T, arena_allocator<T>>;
+
+namespace impl {
+
+/*
+ * limb_scratch (Arena operands take their scratch limbs from the arena's scratch buffer)
+ *
+ * Every instance on an arena shares its one buffer, so at most one may be
+ * alive per arena at a time; debug builds assert this.
+ */
+template<typename T>
+class limb_scratch<T, arena_allocator<T>> {
+public:
+    limb_scratch(const arena_allocator<T>& source, std::size_t count) :
+        arena(source.arena),
+        limbs(static_cast<T*>(source.arena->acquire_scratch(count * sizeof(T))))
+    {}
+
+    limb_scratch(const limb_scratch&) = delete;
+    limb_scratch& operator=(const limb_scratch&) = delete;
+
+    ~limb_scratch() {
+        arena->release_scratch();
+    }
+
+    T* data() noexcept {
+        return limbs;
+    }
+
+private:
+    limb_arena* arena;
+    T* limbs;
+};
+
+} //namespace impl
+
+} //namespace numbers
+
+#endif//NUMBERS_ARENA_HH
@@ -0,0 +1,118 @@
+#ifndef NUMBERS_BARRETT_HH
+#define NUMBERS_BARRETT_HH
+
+#include "bigint.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace numbers {
+
+/*
+ * barrett_context (Reduction modulo a fixed non-zero modulus by a precomputed reciprocal)
+ *
+ * With k the bit length of the modulus, mu = floor(4^k / modulus). reduce
+ * accepts any value below 4^k, in particular every product of two values
+ * below the modulus, and costs two multiplications and at most two
+ * subtractions.
+ */
+template<std::size_t BITS, typename T = std::uint32_t>
+struct barrett_context {
+    typedef bigint<BITS, T> value_type;
+    static constexpr std::size_t count = value_type::count;
+
+    value_type modulus;
+    std::array<T, count + 1> mu;    // floor(4^k / modulus), at most k + 2 bits
+    std::size_t k;                  // bit length of the modulus
+
+    constexpr explicit barrett_context(const value_type& m) :
+        modulus(m),
+        mu{},
+        k(0)
+    {
+        constexpr int DIGITS = std::numeric_limits<T>::digits;
+        k = m.highest_bit();
+        std::array<T, 2 * count + 1> power = {};
+        std::array<T, 2 * count + 1> quotient = {};
+        std::array<T, count> remainder = {};
+        power[2 * k / DIGITS] = static_cast<T>(one<T>::value << (2 * k % DIGITS));
+        impl::divide_limbs<T, 2 * count + 1, count>(quotient.data(), remainder.data(), power.data(), modulus.data());
+        for (std::size_t i = 0; i < count + 1; ++i) {
+            mu[i] = quotient[i];
+        }
+    }
+
+    /*
+     * reduce (x mod modulus for x < 4^k)
+     */
+    template<std::size_t X_BITS>
+    constexpr value_type reduce(const bigint<X_BITS, T>& x) const {
+        static_assert(X_BITS <= 2 * BITS, "reduce takes at most a double width value");
+        constexpr std::size_t N = count + 1;
+        constexpr std::size_t KT = impl::karatsuba_threshold<T>::value;
+        constexpr std::size_t TT = impl::toom3_threshold<T>::value;
+
+        // q = ((x >> (k - 1)) * mu) >> (k + 1) underestimates x / modulus by at most two
+        std::array<T, N> q1 = {};
+        impl::shift_right_limbs(q1.data(), N, x.data(), x.count, k - 1);
+        std::array<T, 2 * N> q2 = {};
+        impl::multiply_limbs<T, N, N, KT, TT>(q2.data(), q1.data(), mu.data());
+        std::array<T, N> q3 = {};
+        impl::shift_right_limbs(q3.data(), N, q2.data(), 2 * N, k + 1);
+
+        // r = x - q * modulus < 3 * modulus, so N limbs are enough
+        std::array<T, N + count> product = {};
+        impl::multiply_limbs<T, N, count, KT, TT>(product.data(), q3.data(), modulus.data());
+        std::array<T, N> r = {};
+        for (std::size_t i = 0; i < N && i < x.count; ++i) {
+            r[i] = x[i];
+        }
+        impl::subtract_limbs(r.data(), r.data(), N, product.data(), N);
+
+        std::array<T, N> difference = {};
+        for (int i = 0; i < 2; ++i) {
+            const T borrow = impl::subtract_limbs(difference.data(), r.data(), N, modulus.data(), count);
+            if (borrow == zero<T>::value) {
+                r = difference;
+            }
+        }
+        value_type result = {};
+        for (std::size_t i = 0; i < count; ++i) {
+            result[i] = r[i];
+        }
+        return result;
+    }
+
+    /*
+     * mul_mod (a * b mod modulus for a, b below the modulus)
+     */
+    constexpr value_type mul_mod(const value_type& a, const value_type& b) const {
+        return reduce(multiply(a, b));
+    }
+};
+
+} //namespace numbers
+
+/*
+ * barrett_context
+ */
+static_assert(numbers::barrett_context<24, std::uint8_t>({0x40, 0x42, 0x0F}).k == 20);
+static_assert(numbers::barrett_context<24, std::uint8_t>({0x40, 0x42, 0x0F}).reduce(
+    numbers::bigint<48, std::uint8_t>{0x42, 0x72, 0x5B, 0xD2, 0xE8, 0x00})[0] == 2);
+static_assert(numbers::barrett_context<24, std::uint8_t>({0x40, 0x42, 0x0F}).mul_mod({0x3F, 0x42, 0x0F}, {0x3E, 0x42, 0x0F})[0] == 2);
+static_assert(numbers::barrett_context<24, std::uint8_t>({0x40, 0x42, 0x0F}).reduce(numbers::bigint<48, std::uint8_t>{})[0] == 0);
+static_assert(numbers::barrett_context<32, std::uint32_t>({1}).reduce(numbers::bigint<32, std::uint32_t>{0})[0] == 0);
+static_assert(numbers::barrett_context<32, std::uint32_t>({7}).reduce(numbers::bigint<32, std::uint32_t>{48})[0] == 6);
+static_assert([] {
+    constexpr numbers::barrett_context<128, std::uint32_t> m({0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF});
+    const auto r = m.mul_mod({0xFFFFFFFB, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF}, {0xFFFFFFFB, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF});
+    return r[0] == 16 && r[1] == 0 && r[2] == 0 && r[3] == 0;
+}());
+static_assert([] {
+    constexpr numbers::barrett_context<64, std::uint64_t> m({0xFFFFFFFFFFFFFFC5});
+    const auto r = m.mul_mod({0xFFFFFFFFFFFFFFC4}, {0xFFFFFFFFFFFFFFC3});
+    return r[0] == 2;
+}());
+
+#endif//NUMBERS_BARRETT_HH
@@ -2,11 +2,17 @@
 #define NUMBERS_BIGINT_HH
 
 #include "elementary.hpp"
+#include "platform.hpp"
 #include "radix.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
 
 namespace numbers {
@@ -32,67 +38,1386 @@ struct bigint_datatype<std::uint32_t> {
     typedef std::uint64_t overflow_type;
 };
 
+#ifdef __SIZEOF_INT128__
+template<>
+struct bigint_datatype<std::uint64_t> {
+    __extension__ typedef unsigned __int128 overflow_type;
+};
+#else
+template<>
+struct bigint_datatype<std::uint64_t> {
+    typedef void overflow_type;
+};
+#endif
+
+/*
+ * add_carry (a + b + carry, carry in and out is 0 or 1)
+ */
+template<typename T>
+constexpr T add_carry(T a, T b, T& carry) {
+    T sum = static_cast<T>(a + b);
+    T overflow = sum < a ? one<T>::value : zero<T>::value;
+    T result = static_cast<T>(sum + carry);
+    carry = static_cast<T>(overflow | (result < sum ? one<T>::value : zero<T>::value));
+    return result;
+}
+
+/*
+ * multiply_high (upper limb of a * b, from half-limb partial products)
+ */
+template<typename T>
+constexpr T multiply_high(T a, T b) {
+    constexpr int HALF = std::numeric_limits<T>::digits / 2;
+    constexpr T MASK = static_cast<T>((one<T>::value << HALF) - 1);
+    T a0 = a & MASK, a1 = static_cast<T>(a >> HALF);
+    T b0 = b & MASK, b1 = static_cast<T>(b >> HALF);
+    T p00 = static_cast<T>(a0 * b0);
+    T p01 = static_cast<T>(a0 * b1);
+    T p10 = static_cast<T>(a1 * b0);
+    T p11 = static_cast<T>(a1 * b1);
+    T middle = static_cast<T>((p00 >> HALF) + (p01 & MASK) + (p10 & MASK));
+    return static_cast<T>(p11 + (p01 >> HALF) + (p10 >> HALF) + (middle >> HALF));
+}
+
+/*
+ * multiply_add (a * b + c + carry, returns the low limb and leaves the high limb in carry)
+ */
+template<typename T, typename OverflowType = typename bigint_datatype<T>::overflow_type>
+constexpr T multiply_add(T a, T b, T c, T& carry) {
+    if constexpr (std::is_void<OverflowType>::value) {
+        T high = multiply_high(a, b);
+        T low = static_cast<T>(a * b);
+        T k = zero<T>::value;
+        low = add_carry(low, c, k);
+        high = static_cast<T>(high + k);
+        k = zero<T>::value;
+        low = add_carry(low, carry, k);
+        carry = static_cast<T>(high + k);
+        return low;
+    } else {
+        OverflowType sum = static_cast<OverflowType>(a) * static_cast<OverflowType>(b)
+                           + static_cast<OverflowType>(c) + static_cast<OverflowType>(carry);
+        carry = static_cast<T>(sum >> std::numeric_limits<T>::digits);
+        return static_cast<T>(sum);
+    }
+}
+
+/*
+ * karatsuba_threshold (Limb count at which multiply switches from schoolbook to Karatsuba)
+ */
+template<typename T>
+struct karatsuba_threshold : identity<std::size_t, 32> {};
+
+/*
+ * toom3_threshold (Limb count at which multiply switches from Karatsuba to Toom-3)
+ */
+template<typename T>
+struct toom3_threshold : identity<std::size_t, 160> {};
+
+/*
+ * carry_intrinsics (Limb types the runtime adc/sbb kernels handle)
+ */
+template<typename T>
+struct carry_intrinsics :
+    identity<bool,
+#if defined(NUMBERS_X86_64)
+        std::is_unsigned<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)
+#else
+        false
+#endif
+    >
+{};
+
+#if defined(NUMBERS_X86_64)
+/*
+ * add_limbs_adc (Runtime add_limbs as a single adc chain)
+ */
+template<typename T>
+inline T add_limbs_adc(T* out, const T* a, std::size_t n, const T* b, std::size_t m) {
+    unsigned char carry = 0;
+    std::size_t i = 0;
+    if constexpr (sizeof(T) == 8) {
+        unsigned long long sum;
+        for (; i < m; ++i) {
+            carry = _addcarry_u64(carry, a[i], b[i], &sum);
+            out[i] = static_cast<T>(sum);
+        }
+        for (; i < n; ++i) {
+            carry = _addcarry_u64(carry, a[i], 0, &sum);
+            out[i] = static_cast<T>(sum);
+        }
+    } else {
+        unsigned int sum;
+        for (; i < m; ++i) {
+            carry = _addcarry_u32(carry, a[i], b[i], &sum);
+            out[i] = static_cast<T>(sum);
+        }
+        for (; i < n; ++i) {
+            carry = _addcarry_u32(carry, a[i], 0, &sum);
+            out[i] = static_cast<T>(sum);
+        }
+    }
+    return static_cast<T>(carry);
+}
+
+/*
+ * subtract_limbs_sbb (Runtime subtract_limbs as a single sbb chain)
+ */
+template<typename T>
+inline T subtract_limbs_sbb(T* out, const T* a, std::size_t n, const T* b, std::size_t m) {
+    unsigned char borrow = 0;
+    std::size_t i = 0;
+    if constexpr (sizeof(T) == 8) {
+        unsigned long long difference;
+        for (; i < m; ++i) {
+            borrow = _subborrow_u64(borrow, a[i], b[i], &difference);
+            out[i] = static_cast<T>(difference);
+        }
+        for (; i < n; ++i) {
+            borrow = _subborrow_u64(borrow, a[i], 0, &difference);
+            out[i] = static_cast<T>(difference);
+        }
+    } else {
+        unsigned int difference;
+        for (; i < m; ++i) {
+            borrow = _subborrow_u32(borrow, a[i], b[i], &difference);
+            out[i] = static_cast<T>(difference);
+        }
+        for (; i < n; ++i) {
+            borrow = _subborrow_u32(borrow, a[i], 0, &difference);
+            out[i] = static_cast<T>(difference);
+        }
+    }
+    return static_cast<T>(borrow);
+}
+#endif
+
+#if defined(NUMBERS_X86_64) && defined(__GNUC__) && defined(__BMI2__) && defined(__ADX__)
+#define NUMBERS_MULTIPLY_ADD_ROW_ADX 1
+/*
+ * multiply_add_row_adx (Runtime multiply_add_row, mulx products on two independent adcx/adox chains)
+ *
+ * Compilers lower _addcarryx_u64 to a single adc chain, so four limbs at a
+ * time are written out by hand; both chains are folded into the carry limb
+ * at the end of each block, which cannot overflow.
+ */
+inline std::uint64_t multiply_add_row_adx(std::uint64_t* out, const std::uint64_t* a, std::size_t n, std::uint64_t b) {
+    const std::size_t blocks = n - n % 4;
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < blocks; i += 4) {
+        std::uint64_t low, high0, high1, zero;
+        __asm__(
+            "xorl %k[zero], %k[zero]\n\t"
+            "mulxq 0(%[a]), %[low], %[high0]\n\t"
+            "adcxq 0(%[out]), %[low]\n\t"
+            "adoxq %[carry], %[low]\n\t"
+            "movq %[low], 0(%[out])\n\t"
+            "mulxq 8(%[a]), %[low], %[high1]\n\t"
+            "adcxq 8(%[out]), %[low]\n\t"
+            "adoxq %[high0], %[low]\n\t"
+            "movq %[low], 8(%[out])\n\t"
+            "mulxq 16(%[a]), %[low], %[high0]\n\t"
+            "adcxq 16(%[out]), %[low]\n\t"
+            "adoxq %[high1], %[low]\n\t"
+            "movq %[low], 16(%[out])\n\t"
+            "mulxq 24(%[a]), %[low], %[high1]\n\t"
+            "adcxq 24(%[out]), %[low]\n\t"
+            "adoxq %[high0], %[low]\n\t"
+            "movq %[low], 24(%[out])\n\t"
+            "adcxq %[zero], %[high1]\n\t"
+            "adoxq %[zero], %[high1]\n\t"
+            "movq %[high1], %[carry]"
+            : [carry] "+r"(carry), [low] "=&r"(low), [high0] "=&r"(high0), [high1] "=&r"(high1), [zero] "=&r"(zero)
+            : [out] "r"(out + i), [a] "r"(a + i), "d"(b)
+            : "cc", "memory");
+    }
+    for (std::size_t i = blocks; i < n; ++i) {
+        out[i] = multiply_add(a[i], b, out[i], carry);
+    }
+    return carry;
+}
+#endif
+
+/*
+ * multiply_add_row (out[0, n) += a[0, n) * b, returns the limb carried out)
+ */
+template<typename T>
+constexpr T multiply_add_row(T* out, const T* a, std::size_t n, T b) {
+#if defined(NUMBERS_MULTIPLY_ADD_ROW_ADX)
+    if constexpr (std::is_same<T, std::uint64_t>::value) {
+        if (!is_constant_evaluated()) {
+            return multiply_add_row_adx(out, a, n, b);
+        }
+    }
+#endif
+    T k = zero<T>::value;
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = multiply_add(a[i], b, out[i], k);
+    }
+    return k;
+}
+
+/*
+ * add_limbs (out[0, n) = a[0, n) + b[0, m) for m <= n, returns the carry)
+ */
+template<typename T>
+constexpr T add_limbs(T* out, const T* a, std::size_t n, const T* b, std::size_t m) {
+#if defined(NUMBERS_X86_64)
+    if constexpr (carry_intrinsics<T>::value) {
+        if (!is_constant_evaluated()) {
+            return add_limbs_adc(out, a, n, b, m);
+        }
+    }
+#endif
+    T carry = zero<T>::value;
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = add_carry(a[i], i < m ? b[i] : zero<T>::value, carry);
+    }
+    return carry;
+}
+
+/*
+ * increment_limbs (a[0, n) += carry, stopping as soon as the carry clears; returns the carry out)
+ */
+template<typename T>
+constexpr T increment_limbs(T* a, std::size_t n, T carry) {
+    for (std::size_t i = 0; i < n && carry != zero<T>::value; ++i) {
+        a[i] = static_cast<T>(a[i] + carry);
+        carry = a[i] < carry ? one<T>::value : zero<T>::value;
+    }
+    return carry;
+}
+
+/*
+ * decrement_limbs (a[0, n) -= borrow, stopping as soon as the borrow clears; returns the borrow out)
+ */
+template<typename T>
+constexpr T decrement_limbs(T* a, std::size_t n, T borrow) {
+    for (std::size_t i = 0; i < n && borrow != zero<T>::value; ++i) {
+        const T previous = a[i];
+        a[i] = static_cast<T>(previous - borrow);
+        borrow = previous < borrow ? one<T>::value : zero<T>::value;
+    }
+    return borrow;
+}
+
+/*
+ * subtract_limbs (out[0, n) = a[0, n) - b[0, m) for m <= n, returns the borrow)
+ */
+template<typename T>
+constexpr T subtract_limbs(T* out, const T* a, std::size_t n, const T* b, std::size_t m) {
+#if defined(NUMBERS_X86_64)
+    if constexpr (carry_intrinsics<T>::value) {
+        if (!is_constant_evaluated()) {
+            return subtract_limbs_sbb(out, a, n, b, m);
+        }
+    }
+#endif
+    T borrow = zero<T>::value;
+    for (std::size_t i = 0; i < n; ++i) {
+        T ai = a[i];
+        T bi = i < m ? b[i] : zero<T>::value;
+        T difference = static_cast<T>(ai - bi);
+        T next = ai < bi ? one<T>::value : zero<T>::value;
+        next = static_cast<T>(next | (difference < borrow ? one<T>::value : zero<T>::value));
+        out[i] = static_cast<T>(difference - borrow);
+        borrow = next;
+    }
+    return borrow;
+}
+
+/*
+ * negate_limbs (Two's complement negation of a[0, n) in place)
+ */
+template<typename T>
+constexpr void negate_limbs(T* a, std::size_t n) {
+    T carry = one<T>::value;
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = add_carry(static_cast<T>(~a[i]), zero<T>::value, carry);
+    }
+}
+
+/*
+ * halve_limbs (Arithmetic shift right by one of the two's complement value a[0, n))
+ */
+template<typename T>
+constexpr void halve_limbs(T* a, std::size_t n) {
+    constexpr int TOP = std::numeric_limits<T>::digits - 1;
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        a[i] = static_cast<T>((a[i] >> 1) | (a[i + 1] << TOP));
+    }
+    a[n - 1] = static_cast<T>((a[n - 1] >> 1) | (a[n - 1] & (one<T>::value << TOP)));
+}
+
+/*
+ * divide_exact_3_limbs (a[0, n) / 3 for exact multiples, by Hensel division modulo 2^(n * digits))
+ */
+template<typename T>
+constexpr void divide_exact_3_limbs(T* a, std::size_t n) {
+    constexpr T INVERSE = static_cast<T>(std::numeric_limits<T>::max() / 3 * 2 + 1);
+    T borrow = zero<T>::value;
+    for (std::size_t i = 0; i < n; ++i) {
+        T below = a[i] < borrow ? one<T>::value : zero<T>::value;
+        T q = static_cast<T>(static_cast<T>(a[i] - borrow) * INVERSE);
+        a[i] = q;
+        borrow = zero<T>::value;
+        multiply_add(q, three<T>::value, zero<T>::value, borrow);
+        borrow = static_cast<T>(borrow + below);
+    }
+}
+
+/*
+ * multiply_schoolbook (out[0, n + m) = a[0, n) * b[0, m))
+ */
+template<typename T>
+constexpr void multiply_schoolbook(T* out, const T* a, std::size_t n, const T* b, std::size_t m) {
+    for (std::size_t i = 0; i < n + m; ++i) {
+        out[i] = zero<T>::value;
+    }
+    for (std::size_t bi = 0; bi < m; ++bi) {
+        out[bi + n] = multiply_add_row(out + bi, a, n, b[bi]);
+    }
+}
+
+template<typename T, std::size_t NA, std::size_t NB, std::size_t KARATSUBA_THRESHOLD, std::size_t TOOM3_THRESHOLD>
+constexpr void multiply_limbs(T* out, const T* a, const T* b);
+
+/*
+ * multiply_karatsuba (out[0, 2N) = a[0, N) * b[0, N))
+ *
+ * The carries out of the half sums are applied as linear corrections so
+ * that every recursive product is at most ceil(N / 2) limbs wide.
+ */
+template<typename T, std::size_t N, std::size_t KARATSUBA_THRESHOLD, std::size_t TOOM3_THRESHOLD>
+constexpr void multiply_karatsuba(T* out, const T* a, const T* b) {
+    constexpr std::size_t H = (N + 1) / 2;
+    constexpr std::size_t L = N - H;
+    multiply_limbs<T, H, H, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out, a, b);
+    multiply_limbs<T, L, L, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out + 2 * H, a + H, b + H);
+
+    std::array<T, H> sa = {};
+    std::array<T, H> sb = {};
+    const T ca = add_limbs(sa.data(), a, H, a + H, L);
+    const T cb = add_limbs(sb.data(), b, H, b + H, L);
+
+    std::array<T, 2 * H + 2> middle = {};
+    multiply_limbs<T, H, H, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(middle.data(), sa.data(), sb.data());
+    if (ca) {
+        add_limbs(middle.data() + H, middle.data() + H, H + 2, sb.data(), H);
+    }
+    if (cb) {
+        add_limbs(middle.data() + H, middle.data() + H, H + 2, sa.data(), H);
+    }
+    if (ca && cb) {
+        const T carry = one<T>::value;
+        add_limbs(middle.data() + 2 * H, middle.data() + 2 * H, 2, &carry, 1);
+    }
+    subtract_limbs(middle.data(), middle.data(), 2 * H + 2, out, 2 * H);
+    subtract_limbs(middle.data(), middle.data(), 2 * H + 2, out + 2 * H, 2 * L);
+    add_limbs(out + H, out + H, 2 * N - H, middle.data(), std::min(2 * H + 2, 2 * N - H));
+}
+
+/*
+ * multiply_toom3 (out[0, 2N) = a[0, N) * b[0, N))
+ *
+ * Evaluates at 0, 1, -1, -2 and infinity and interpolates with Bodrato's
+ * sequence. Signed intermediates are kept in two's complement, which makes
+ * the exact divisions by 2 and 3 a shift and a Hensel division.
+ */
+template<typename T, std::size_t N, std::size_t KARATSUBA_THRESHOLD, std::size_t TOOM3_THRESHOLD>
+constexpr void multiply_toom3(T* out, const T* a, const T* b) {
+    constexpr std::size_t P = (N + 2) / 3;
+    constexpr std::size_t R = N - 2 * P;
+    constexpr std::size_t E = P + 1;
+    constexpr std::size_t K = 2 * E;
+    constexpr int TOP = std::numeric_limits<T>::digits - 1;
+
+    struct evaluation {
+        std::array<T, E> one = {};
+        std::array<T, E> minus_one = {};
+        std::array<T, E> minus_two = {};
+        bool minus_one_negative = false;
+        bool minus_two_negative = false;
+    };
+    auto evaluate = [](const T* x) {
+        evaluation e = {};
+        std::array<T, E> s = {};
+        s[P] = add_limbs(s.data(), x, P, x + 2 * P, R);
+        add_limbs(e.one.data(), s.data(), E, x + P, P);
+        subtract_limbs(e.minus_one.data(), s.data(), E, x + P, P);
+        add_limbs(e.minus_two.data(), e.minus_one.data(), E, x + 2 * P, R);
+        add_limbs(e.minus_two.data(), e.minus_two.data(), E, e.minus_two.data(), E);
+        subtract_limbs(e.minus_two.data(), e.minus_two.data(), E, x, P);
+        e.minus_one_negative = (e.minus_one[E - 1] >> TOP) != 0;
+        if (e.minus_one_negative) {
+            negate_limbs(e.minus_one.data(), E);
+        }
+        e.minus_two_negative = (e.minus_two[E - 1] >> TOP) != 0;
+        if (e.minus_two_negative) {
+            negate_limbs(e.minus_two.data(), E);
+        }
+        return e;
+    };
+    const evaluation ea = evaluate(a);
+    const evaluation eb = evaluate(b);
+
+    for (std::size_t i = 2 * P; i < 4 * P; ++i) {
+        out[i] = zero<T>::value;
+    }
+    multiply_limbs<T, P, P, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out, a, b);
+    multiply_limbs<T, R, R, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out + 4 * P, a + 2 * P, b + 2 * P);
+    const T* r0 = out;
+    const T* r4 = out + 4 * P;
+
+    std::array<T, K> r1 = {};
+    std::array<T, K> r2 = {};
+    std::array<T, K> r3 = {};
+    multiply_limbs<T, E, E, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(r1.data(), ea.one.data(), eb.one.data());
+    multiply_limbs<T, E, E, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(r2.data(), ea.minus_one.data(), eb.minus_one.data());
+    if (ea.minus_one_negative != eb.minus_one_negative) {
+        negate_limbs(r2.data(), K);
+    }
+    multiply_limbs<T, E, E, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(r3.data(), ea.minus_two.data(), eb.minus_two.data());
+    if (ea.minus_two_negative != eb.minus_two_negative) {
+        negate_limbs(r3.data(), K);
+    }
+
+    // r3 = (v(-2) - v(1)) / 3
+    subtract_limbs(r3.data(), r3.data(), K, r1.data(), K);
+    divide_exact_3_limbs(r3.data(), K);
+    // r1 = (v(1) - v(-1)) / 2
+    subtract_limbs(r1.data(), r1.data(), K, r2.data(), K);
+    halve_limbs(r1.data(), K);
+    // r2 = v(-1) - v(0)
+    subtract_limbs(r2.data(), r2.data(), K, r0, 2 * P);
+    // r3 = (r2 - r3) / 2 + 2 * v(inf)
+    subtract_limbs(r3.data(), r2.data(), K, r3.data(), K);
+    halve_limbs(r3.data(), K);
+    add_limbs(r3.data(), r3.data(), K, r4, 2 * R);
+    add_limbs(r3.data(), r3.data(), K, r4, 2 * R);
+    // r2 = r2 + r1 - v(inf)
+    add_limbs(r2.data(), r2.data(), K, r1.data(), K);
+    subtract_limbs(r2.data(), r2.data(), K, r4, 2 * R);
+    // r1 = r1 - r3
+    subtract_limbs(r1.data(), r1.data(), K, r3.data(), K);
+
+    add_limbs(out + P, out + P, 2 * N - P, r1.data(), std::min(K, 2 * N - P));
+    add_limbs(out + 2 * P, out + 2 * P, 2 * N - 2 * P, r2.data(), std::min(K, 2 * N - 2 * P));
+    add_limbs(out + 3 * P, out + 3 * P, 2 * N - 3 * P, r3.data(), std::min(K, 2 * N - 3 * P));
+}
+
+/*
+ * multiply_limbs (out[0, NA + NB) = a[0, NA) * b[0, NB), algorithm chosen from the limb counts)
+ */
+template<typename T, std::size_t NA, std::size_t NB, std::size_t KARATSUBA_THRESHOLD, std::size_t TOOM3_THRESHOLD>
+constexpr void multiply_limbs(T* out, const T* a, const T* b) {
+    static_assert(KARATSUBA_THRESHOLD >= 2, "Karatsuba needs at least two limbs to split");
+    static_assert(TOOM3_THRESHOLD >= 5, "Toom-3 needs at least five limbs to split");
+    if constexpr (NA < NB) {
+        multiply_limbs<T, NB, NA, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out, b, a);
+    } else if constexpr (NB < KARATSUBA_THRESHOLD) {
+        multiply_schoolbook(out, a, NA, b, NB);
+    } else if constexpr (NA == NB && NA >= TOOM3_THRESHOLD) {
+        multiply_toom3<T, NA, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out, a, b);
+    } else if constexpr (NA == NB) {
+        multiply_karatsuba<T, NA, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out, a, b);
+    } else {
+        // Unbalanced operands: multiply NB-limb blocks of a by b and accumulate.
+        constexpr std::size_t BLOCKS = NA / NB;
+        constexpr std::size_t REST = NA % NB;
+        for (std::size_t i = 0; i < NA + NB; ++i) {
+            out[i] = zero<T>::value;
+        }
+        std::array<T, 2 * NB> block = {};
+        for (std::size_t i = 0; i < BLOCKS; ++i) {
+            multiply_limbs<T, NB, NB, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(block.data(), a + i * NB, b);
+            add_limbs(out + i * NB, out + i * NB, NA + NB - i * NB, block.data(), 2 * NB);
+        }
+        if constexpr (REST > 0) {
+            std::array<T, REST + NB> tail = {};
+            multiply_limbs<T, REST, NB, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(tail.data(), a + BLOCKS * NB, b);
+            add_limbs(out + BLOCKS * NB, out + BLOCKS * NB, REST + NB, tail.data(), REST + NB);
+        }
+    }
+}
+
+template<typename T, std::size_t N, std::size_t KARATSUBA_THRESHOLD, std::size_t TOOM3_THRESHOLD>
+constexpr void square_limbs(T* out, const T* a);
+
+/*
+ * square_schoolbook (out[0, 2n) = a[0, n)^2, each off-diagonal product computed once and doubled)
+ */
+template<typename T>
+constexpr void square_schoolbook(T* out, const T* a, std::size_t n) {
+    constexpr int TOP = std::numeric_limits<T>::digits - 1;
+    for (std::size_t i = 0; i < 2 * n; ++i) {
+        out[i] = zero<T>::value;
+    }
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        out[i + n] = multiply_add_row(out + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+    }
+    T shifted = zero<T>::value;
+    T carry = zero<T>::value;
+    for (std::size_t i = 0; i < n; ++i) {
+        T high = zero<T>::value;
+        T low = multiply_add(a[i], a[i], zero<T>::value, high);
+        T even = out[2 * i];
+        T odd = out[2 * i + 1];
+        out[2 * i] = add_carry(static_cast<T>((even << 1) | shifted), low, carry);
+        out[2 * i + 1] = add_carry(static_cast<T>((odd << 1) | (even >> TOP)), high, carry);
+        shifted = static_cast<T>(odd >> TOP);
+    }
+}
+
+/*
+ * square_karatsuba (out[0, 2N) = a[0, N)^2 from three half-width squares)
+ */
+template<typename T, std::size_t N, std::size_t KARATSUBA_THRESHOLD, std::size_t TOOM3_THRESHOLD>
+constexpr void square_karatsuba(T* out, const T* a) {
+    constexpr std::size_t H = (N + 1) / 2;
+    constexpr std::size_t L = N - H;
+    square_limbs<T, H, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out, a);
+    square_limbs<T, L, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out + 2 * H, a + H);
+
+    std::array<T, H> sa = {};
+    const T ca = add_limbs(sa.data(), a, H, a + H, L);
+
+    std::array<T, 2 * H + 2> middle = {};
+    square_limbs<T, H, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(middle.data(), sa.data());
+    if (ca) {
+        add_limbs(middle.data() + H, middle.data() + H, H + 2, sa.data(), H);
+        add_limbs(middle.data() + H, middle.data() + H, H + 2, sa.data(), H);
+        const T carry = one<T>::value;
+        add_limbs(middle.data() + 2 * H, middle.data() + 2 * H, 2, &carry, 1);
+    }
+    subtract_limbs(middle.data(), middle.data(), 2 * H + 2, out, 2 * H);
+    subtract_limbs(middle.data(), middle.data(), 2 * H + 2, out + 2 * H, 2 * L);
+    add_limbs(out + H, out + H, 2 * N - H, middle.data(), std::min(2 * H + 2, 2 * N - H));
+}
+
+/*
+ * square_limbs (out[0, 2N) = a[0, N)^2, algorithm chosen from the limb count)
+ */
+template<typename T, std::size_t N, std::size_t KARATSUBA_THRESHOLD, std::size_t TOOM3_THRESHOLD>
+constexpr void square_limbs(T* out, const T* a) {
+    if constexpr (N < KARATSUBA_THRESHOLD) {
+        square_schoolbook(out, a, N);
+    } else if constexpr (N >= TOOM3_THRESHOLD) {
+        multiply_toom3<T, N, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out, a, a);
+    } else {
+        square_karatsuba<T, N, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(out, a);
+    }
+}
+
+/*
+ * count_leading_zeros (Zero bits above the highest set bit, digits for zero)
+ */
+template<typename T>
+constexpr int count_leading_zeros(T x) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    if (x == zero<T>::value) {
+        return DIGITS;
+    }
+#if defined(__cpp_lib_bitops)
+    return std::countl_zero(x);
+#else
+#if defined(NUMBERS_BIT_BUILTINS)
+    constexpr int UINT_DIGITS = std::numeric_limits<unsigned int>::digits;
+    constexpr int ULLONG_DIGITS = std::numeric_limits<unsigned long long>::digits;
+    if constexpr (DIGITS <= UINT_DIGITS) {
+        return __builtin_clz(x) - (UINT_DIGITS - DIGITS);
+    } else if constexpr (DIGITS <= ULLONG_DIGITS) {
+        return __builtin_clzll(x) - (ULLONG_DIGITS - DIGITS);
+    }
+#endif
+    int n = 0;
+    for (int shift = std::numeric_limits<T>::digits / 2; shift > 0; shift /= 2) {
+        if ((x >> (std::numeric_limits<T>::digits - shift)) == zero<T>::value) {
+            x = static_cast<T>(x << shift);
+            n += shift;
+        }
+    }
+    return n;
+#endif
+}
+
+/*
+ * divide_wide ((high, low) / divisor for high < divisor, returns the quotient limb)
+ */
+template<typename T, typename OverflowType = typename bigint_datatype<T>::overflow_type>
+constexpr T divide_wide(T high, T low, T divisor, T& remainder) {
+    if constexpr (std::is_void<OverflowType>::value) {
+        constexpr int TOP = std::numeric_limits<T>::digits - 1;
+        for (int i = 0; i <= TOP; ++i) {
+            const bool overflow = (high >> TOP) != 0;
+            high = static_cast<T>((high << 1) | (low >> TOP));
+            low = static_cast<T>(low << 1);
+            if (overflow || high >= divisor) {
+                high = static_cast<T>(high - divisor);
+                low = static_cast<T>(low | one<T>::value);
+            }
+        }
+        remainder = high;
+        return low;
+    } else {
+        OverflowType dividend = (static_cast<OverflowType>(high) << std::numeric_limits<T>::digits)
+                                | static_cast<OverflowType>(low);
+        remainder = static_cast<T>(dividend % divisor);
+        return static_cast<T>(dividend / divisor);
+    }
+}
+
+/*
+ * used_limbs (Number of limbs below the highest non-zero limb)
+ */
+template<typename T>
+constexpr std::size_t used_limbs(const T* a, std::size_t n) {
+    while (n > 0 && a[n - 1] == zero<T>::value) {
+        --n;
+    }
+    return n;
+}
+
+/*
+ * to_word (value = a[0, n) when it fits in 64 bits, false otherwise)
+ */
+template<typename T>
+constexpr bool to_word(const T* a, std::size_t n, std::uint64_t& value) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    value = 0;
+    for (std::size_t i = used_limbs(a, n); i > 0; --i) {
+        if (DIGITS < 64 && (value >> (64 - DIGITS)) != 0) {
+            return false;
+        }
+        value = DIGITS < 64 ? (value << (DIGITS % 64)) | a[i - 1] : a[i - 1];
+        if (DIGITS >= 64 && i > 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * from_word (a[0, n) = value, false when it does not fit)
+ */
+template<typename T>
+constexpr bool from_word(T* a, std::size_t n, std::uint64_t value) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = static_cast<T>(value);
+        value = DIGITS < 64 ? value >> (DIGITS % 64) : 0;
+    }
+    return value == 0;
+}
+
+/*
+ * shift_right_limbs (out[0, out_n) = a[0, n) >> shift, limbs past n read as zero)
+ */
+template<typename T>
+constexpr void shift_right_limbs(T* out, std::size_t out_n, const T* a, std::size_t n, std::size_t shift) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    const std::size_t limbs = shift / DIGITS;
+    const int bits = static_cast<int>(shift % DIGITS);
+    for (std::size_t i = 0; i < out_n; ++i) {
+        const std::size_t j = i + limbs;
+        const T low = j < n ? a[j] : zero<T>::value;
+        const T high = j + 1 < n ? a[j + 1] : zero<T>::value;
+        out[i] = bits == 0 ? low : static_cast<T>((low >> bits) | (high << (DIGITS - bits)));
+    }
+}
+
+/*
+ * shift_left_limbs (out[0, out_n) = a[0, n) << shift, bits past out_n are dropped)
+ *
+ * Runs from the top limb down, so out may alias a.
+ */
+template<typename T>
+constexpr void shift_left_limbs(T* out, std::size_t out_n, const T* a, std::size_t n, std::size_t shift) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    const std::size_t limbs = shift / DIGITS;
+    const int bits = static_cast<int>(shift % DIGITS);
+    for (std::size_t i = out_n; i > 0; --i) {
+        const std::size_t j = i - 1;
+        const T high = j >= limbs && j - limbs < n ? a[j - limbs] : zero<T>::value;
+        const T low = j >= limbs + 1 && j - limbs - 1 < n ? a[j - limbs - 1] : zero<T>::value;
+        out[j] = bits == 0 ? high : static_cast<T>(static_cast<T>(high << bits) | (low >> (DIGITS - bits)));
+    }
+}
+
+/*
+ * count_trailing_zeros (Zero bits below the lowest set bit, digits for zero)
+ */
+template<typename T>
+constexpr int count_trailing_zeros(T x) {
+    if (x == zero<T>::value) {
+        return std::numeric_limits<T>::digits;
+    }
+#if defined(__cpp_lib_bitops)
+    return std::countr_zero(x);
+#else
+#if defined(NUMBERS_BIT_BUILTINS)
+    if constexpr (std::numeric_limits<T>::digits <= std::numeric_limits<unsigned int>::digits) {
+        return __builtin_ctz(x);
+    } else if constexpr (std::numeric_limits<T>::digits <= std::numeric_limits<unsigned long long>::digits) {
+        return __builtin_ctzll(x);
+    }
+#endif
+    int n = 0;
+    for (int shift = std::numeric_limits<T>::digits / 2; shift > 0; shift /= 2) {
+        if (static_cast<T>(x << (std::numeric_limits<T>::digits - shift)) == zero<T>::value) {
+            x = static_cast<T>(x >> shift);
+            n += shift;
+        }
+    }
+    return n;
+#endif
+}
+
+/*
+ * count_ones (Set bits of a limb)
+ */
+template<typename T>
+constexpr int count_ones(T x) {
+#if defined(__cpp_lib_bitops)
+    return std::popcount(x);
+#else
+#if defined(NUMBERS_BIT_BUILTINS)
+    if constexpr (std::numeric_limits<T>::digits <= std::numeric_limits<unsigned int>::digits) {
+        return __builtin_popcount(x);
+    } else if constexpr (std::numeric_limits<T>::digits <= std::numeric_limits<unsigned long long>::digits) {
+        return __builtin_popcountll(x);
+    }
+#endif
+    int n = 0;
+    while (x != zero<T>::value) {
+        x = static_cast<T>(x & (x - 1));
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/*
+ * top_limb_mask (Bits of the top limb that lie below BITS)
+ */
+template<typename T, std::size_t BITS>
+struct top_limb_mask : identity<
+    T,
+    BITS % std::numeric_limits<T>::digits == 0
+        ? static_cast<T>(~zero<T>::value)
+        : static_cast<T>((one<T>::value << (BITS % std::numeric_limits<T>::digits)) - 1u)
+> {};
+
+/*
+ * log2_fraction_bits (Fractional bits of the fixed-point logarithms that estimate integer logarithms)
+ */
+struct log2_fraction_bits : identity<int, 30> {};
+
+/*
+ * log2_fixed (log2(a[0, n)) in fixed point, rounded down, zero for zero)
+ *
+ * The integer part is the bit length less one. The fraction comes from
+ * the top 64 bits of a, normalized to [1, 2) and squared once per bit.
+ */
+template<typename T>
+constexpr std::uint64_t log2_fixed(const T* a, std::size_t n) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    const std::size_t used = used_limbs(a, n);
+    if (used == 0) {
+        return 0;
+    }
+    const std::size_t bits = used * DIGITS - count_leading_zeros(a[used - 1]);
+    std::array<T, 64 / DIGITS> top = {};
+    shift_right_limbs(top.data(), top.size(), a, used, bits > 64 ? bits - 64 : 0);
+    std::uint64_t x = 0;
+    to_word(top.data(), top.size(), x);
+    x <<= bits < 64 ? 64 - bits : 0;
+
+    std::uint64_t fraction = 0;
+    for (int i = 0; i < log2_fraction_bits::value; ++i) {
+        // x^2 in [1, 4) keeps 62 fraction bits in the high word
+        std::uint64_t high = 0;
+        multiply_add<std::uint64_t>(x, x, 0, high);
+        fraction <<= 1;
+        if ((high >> 63) != 0) {
+            fraction |= 1;
+            x = high;
+        } else {
+            x = high << 1;
+        }
+    }
+    return (static_cast<std::uint64_t>(bits - 1) << log2_fraction_bits::value) | fraction;
+}
+
+#if defined(__AVX2__)
+/*
+ * skip_equal_high_avx2 (Drops equal high limbs 32 bytes at a time, returns the limbs left to compare)
+ */
+template<typename T>
+inline std::size_t skip_equal_high_avx2(const T* a, const T* b, std::size_t n) {
+    constexpr std::size_t BLOCK = 32 / sizeof(T);
+    while (n >= BLOCK) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + n - BLOCK));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + n - BLOCK));
+        const unsigned equal = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+        if (equal != 0xFFFFFFFFu) {
+            // The highest differing byte sits in the limb just below the returned count
+            return n - BLOCK + (31 - static_cast<std::size_t>(count_leading_zeros(~equal))) / sizeof(T) + 1;
+        }
+        n -= BLOCK;
+    }
+    return n;
+}
+#endif
+
+#if defined(__SSE2__)
+/*
+ * skip_equal_high_sse2 (Drops equal high limbs 16 bytes at a time, returns the limbs left to compare)
+ */
+template<typename T>
+inline std::size_t skip_equal_high_sse2(const T* a, const T* b, std::size_t n) {
+    constexpr std::size_t BLOCK = 16 / sizeof(T);
+    while (n >= BLOCK) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + n - BLOCK));
+        const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + n - BLOCK));
+        const unsigned equal = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+        if (equal != 0xFFFFu) {
+            return n - BLOCK + (31 - static_cast<std::size_t>(count_leading_zeros(~equal & 0xFFFFu))) / sizeof(T) + 1;
+        }
+        n -= BLOCK;
+    }
+    return n;
+}
+#endif
+
+/*
+ * compare_simd_threshold (Limb bytes from which compare_limbs skips equal high limbs with SIMD)
+ *
+ * Below this the top limb almost always decides, and the scalar loop exits first.
+ */
+struct compare_simd_threshold : identity<std::size_t, 64> {};
+
+/*
+ * compare_limbs (Sign of a[0, n) - b[0, n), scanning down from the top limb)
+ */
+template<typename T>
+constexpr int compare_limbs(const T* a, const T* b, std::size_t n) {
+    if (!is_constant_evaluated() && n * sizeof(T) >= compare_simd_threshold::value) {
+        if (a[n - 1] != b[n - 1]) {
+            return a[n - 1] < b[n - 1] ? -1 : 1;
+        }
+#if defined(__AVX2__)
+        n = skip_equal_high_avx2(a, b, n - 1);
+#elif defined(__SSE2__)
+        n = skip_equal_high_sse2(a, b, n - 1);
+#endif
+    }
+    for (std::size_t i = n; i > 0; --i) {
+        if (a[i - 1] != b[i - 1]) {
+            return a[i - 1] < b[i - 1] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * divide_normalized (q[0, n - m + 1) = un[0, n + 1) / vn[0, m), leaving the remainder in un[0, m))
+ *
+ * The inner loop of Knuth's Algorithm D. m >= 2, n >= m, the top limb of
+ * vn has its high bit set and un[n] holds the bits shifted out of the
+ * dividend; the remainder comes back shifted by the same amount.
+ */
+template<typename T>
+constexpr void divide_normalized(T* q, T* un, std::size_t n, const T* vn, std::size_t m) {
+    const T top = vn[m - 1];
+    const T next = vn[m - 2];
+    for (std::size_t j = n - m + 1; j > 0; --j) {
+        const std::size_t k = j - 1;
+
+        // Estimate the quotient limb from the top two dividend limbs, then refine with the third.
+        T qhat = zero<T>::value;
+        T rhat = zero<T>::value;
+        bool rhat_overflow = false;
+        if (un[k + m] >= top) {
+            qhat = std::numeric_limits<T>::max();
+            rhat = static_cast<T>(un[k + m - 1] + top);
+            rhat_overflow = rhat < top;
+        } else {
+            qhat = divide_wide(un[k + m], un[k + m - 1], top, rhat);
+        }
+        while (!rhat_overflow) {
+            T high = zero<T>::value;
+            const T low = multiply_add(qhat, next, zero<T>::value, high);
+            if (high < rhat || (high == rhat && low <= un[k + m - 2])) {
+                break;
+            }
+            qhat = static_cast<T>(qhat - 1);
+            rhat = static_cast<T>(rhat + top);
+            rhat_overflow = rhat < top;
+        }
+
+        // Multiply and subtract qhat * vn from un[k, k + m].
+        T carry = zero<T>::value;
+        T borrow = zero<T>::value;
+        for (std::size_t i = 0; i < m; ++i) {
+            const T product = multiply_add(qhat, vn[i], zero<T>::value, carry);
+            const T difference = static_cast<T>(un[k + i] - product);
+            const T next_borrow = static_cast<T>((un[k + i] < product ? 1 : 0) + (difference < borrow ? 1 : 0));
+            un[k + i] = static_cast<T>(difference - borrow);
+            borrow = next_borrow;
+        }
+        const T difference = static_cast<T>(un[k + m] - carry);
+        const bool negative = un[k + m] < carry || difference < borrow;
+        un[k + m] = static_cast<T>(difference - borrow);
+
+        // The estimate was one too large: add the divisor back.
+        if (negative) {
+            qhat = static_cast<T>(qhat - 1);
+            const T overflow = add_limbs(un + k, un + k, m, vn, m);
+            un[k + m] = static_cast<T>(un[k + m] + overflow);
+        }
+        q[k] = qhat;
+    }
+}
+
+/*
+ * divide_limbs (q[0, NA) = u[0, NA) / v[0, NB) and r[0, NB) = u % v, Knuth's Algorithm D)
+ *
+ * v must be non-zero. Divisors with a single used limb take a short
+ * division pass instead.
+ */
+template<typename T, std::size_t NA, std::size_t NB>
+constexpr void divide_limbs(T* q, T* r, const T* u, const T* v) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    for (std::size_t i = 0; i < NA; ++i) {
+        q[i] = zero<T>::value;
+    }
+    for (std::size_t i = 0; i < NB; ++i) {
+        r[i] = zero<T>::value;
+    }
+    // used_limbs never exceeds its bound; the min makes that visible to the optimizer, so the
+    // add-back below is not flagged by -Waggressive-loop-optimizations at -O1.
+    const std::size_t n = std::min(used_limbs(u, NA), NA);
+    const std::size_t m = std::min(used_limbs(v, NB), NB);
+
+    if (n < m) {
+        for (std::size_t i = 0; i < n; ++i) {
+            r[i] = u[i];
+        }
+        return;
+    }
+
+    if (NB == 1 || m == 1) {
+        T remainder = zero<T>::value;
+        for (std::size_t i = n; i > 0; --i) {
+            q[i - 1] = divide_wide(remainder, u[i - 1], v[0], remainder);
+        }
+        r[0] = remainder;
+        return;
+    }
+
+    // Normalize so that the top limb of the divisor has its high bit set.
+    const int s = count_leading_zeros(v[m - 1]);
+    std::array<T, NB> vn = {};
+    std::array<T, NA + 1> un = {};
+    for (std::size_t i = m; i > 0; --i) {
+        const T below = (s > 0 && i > 1) ? static_cast<T>(v[i - 2] >> (DIGITS - s)) : zero<T>::value;
+        vn[i - 1] = static_cast<T>((s > 0 ? static_cast<T>(v[i - 1] << s) : v[i - 1]) | below);
+    }
+    un[n] = s > 0 ? static_cast<T>(u[n - 1] >> (DIGITS - s)) : zero<T>::value;
+    for (std::size_t i = n; i > 0; --i) {
+        const T below = (s > 0 && i > 1) ? static_cast<T>(u[i - 2] >> (DIGITS - s)) : zero<T>::value;
+        un[i - 1] = static_cast<T>((s > 0 ? static_cast<T>(u[i - 1] << s) : u[i - 1]) | below);
+    }
+
+    divide_normalized(q, un.data(), n, vn.data(), m);
+
+    for (std::size_t i = 0; i < m; ++i) {
+        const T above = (s > 0) ? static_cast<T>(un[i + 1] << (DIGITS - s)) : zero<T>::value;
+        r[i] = static_cast<T>((un[i] >> s) | above);
+    }
+}
+
 template<typename T, std::size_t BITS>
 struct required_elements : identity<
     std::size_t,
     (BITS / std::numeric_limits<T>::digits) + (BITS % std::numeric_limits<T>::digits == 0 ? 0 : 1)
 > {};
 
-template<typename T, std::size_t A_BITS, std::size_t B_BITS>
-struct required_bits_addition : identity<std::size_t, std::max(A_BITS, B_BITS) + 1> {};
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+struct required_bits_addition : identity<std::size_t, std::max(A_BITS, B_BITS) + 1> {};
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+struct required_bits_subtraction : identity<std::size_t, std::max(A_BITS, B_BITS)> {};
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+struct required_bits_multiplication : identity<std::size_t, A_BITS + B_BITS> {};
+
+template<typename T, std::size_t BITS, std::size_t SHIFT>
+struct required_bits_shift_left : identity<std::size_t, BITS + SHIFT> {};
+
+template<typename T, std::size_t BITS, std::size_t SHIFT>
+struct required_bits_shift_right : identity<std::size_t, SHIFT < BITS ? BITS - SHIFT : 1> {};
+
+template<typename T>
+struct default_bits : identity<T, 256> {};
+
+/*
+ * required_bits_radix (Generic)
+ */
+template<std::size_t RADIX, std::size_t DIGITS>
+struct required_bits_radix :
+    identity<std::size_t, 0>
+{};
+
+/*
+ * required_bits_radix (Base 2)
+ */
+template<std::size_t DIGITS>
+struct required_bits_radix<2, DIGITS> :
+    identity<std::size_t, DIGITS>
+{};
+
+/*
+ * required_bits_radix (Base 8)
+ */
+template<std::size_t DIGITS>
+struct required_bits_radix<8, DIGITS> :
+    identity<std::size_t, DIGITS * 3>
+{};
+
+/*
+ * required_bits_radix (Base 10)
+ */
+template<std::size_t DIGITS>
+struct required_bits_radix<10, DIGITS> :
+    identity<
+        std::size_t,
+        1 + static_cast<std::size_t>(
+            static_cast<double>(DIGITS) *
+            3.32192809488736234787
+        )
+    >
+{};
+
+/*
+ * required_bits_radix (Base 16)
+ */
+template<std::size_t DIGITS>
+struct required_bits_radix<16, DIGITS> :
+    identity<std::size_t, DIGITS * 4>
+{};
+
+/*
+ * required_bits_radix (Base 64)
+ */
+template<std::size_t DIGITS>
+struct required_bits_radix<64, DIGITS> :
+    identity<std::size_t, DIGITS * 6>
+{};
+
+/*
+ * radix_digit_bits (Bits per digit of a power-of-two radix, 0 otherwise)
+ */
+template<std::size_t RADIX>
+struct radix_digit_bits : identity<int, 0> {};
+
+template<>
+struct radix_digit_bits<2> : identity<int, 1> {};
 
-template<typename T, std::size_t A_BITS, std::size_t B_BITS>
-struct required_bits_multiplication : identity<std::size_t, A_BITS + B_BITS> {};
+template<>
+struct radix_digit_bits<8> : identity<int, 3> {};
 
-template<typename T>
-struct default_bits : identity<T, 256> {};
+template<>
+struct radix_digit_bits<16> : identity<int, 4> {};
+
+template<>
+struct radix_digit_bits<64> : identity<int, 6> {};
 
 /*
- * required_bits_radix (Generic)
+ * required_digits_bits (Generic)
  */
-template<std::size_t RADIX, std::size_t DIGITS>
-struct required_bits_radix :
+template<std::size_t RADIX, std::size_t BITS>
+struct required_digits_bits :
     identity<std::size_t, 0>
 {};
 
 /*
- * required_bits_radix (Base 8)
+ * required_digits_bits (Base 2)
  */
-template<std::size_t DIGITS>
-struct required_bits_radix<8, DIGITS> :
-    identity<std::size_t, DIGITS * 3>
+template<std::size_t BITS>
+struct required_digits_bits<2, BITS> :
+    identity<std::size_t, BITS>
 {};
 
 /*
- * required_bits_radix (Base 10)
+ * required_digits_bits (Base 8)
  */
-template<std::size_t DIGITS>
-struct required_bits_radix<10, DIGITS> :
+template<std::size_t BITS>
+struct required_digits_bits<8, BITS> :
+    identity<std::size_t, (BITS + 2) / 3>
+{};
+
+/*
+ * required_digits_bits (Base 10)
+ */
+template<std::size_t BITS>
+struct required_digits_bits<10, BITS> :
     identity<
         std::size_t,
         1 + static_cast<std::size_t>(
-            static_cast<double>(DIGITS) *
-            3.32192809488736234787
+            static_cast<double>(BITS) *
+            0.30102999566398119521373889472449
         )
     >
 {};
 
 /*
- * required_bits_radix (Base 16)
+ * required_digits_bits (Base 16)
  */
-template<std::size_t DIGITS>
-struct required_bits_radix<16, DIGITS> :
-    identity<std::size_t, DIGITS * 4>
+template<std::size_t BITS>
+struct required_digits_bits<16, BITS> :
+    identity<std::size_t, (BITS + 3) / 4>
 {};
 
 /*
- * required_bits_radix (Base 64)
+ * required_digits_bits (Base 64)
  */
-template<std::size_t DIGITS>
-struct required_bits_radix<64, DIGITS> :
-    identity<std::size_t, DIGITS * 6>
+template<std::size_t BITS>
+struct required_digits_bits<64, BITS> :
+    identity<std::size_t, (BITS + 5) / 6>
 {};
 
+/*
+ * decimal_chunk (Largest power of ten that fits in a limb)
+ */
+template<typename T>
+struct decimal_chunk {
+    static constexpr std::size_t digits = std::numeric_limits<T>::digits10;
+    static constexpr T value = [] {
+        T power = one<T>::value;
+        for (std::size_t i = 0; i < digits; ++i) {
+            power = static_cast<T>(power * 10);
+        }
+        return power;
+    }();
+};
+
+/*
+ * decimal_split_threshold (Chunks of digits above which base 10 parsing splits the input in two)
+ */
+template<typename T>
+struct decimal_split_threshold : identity<std::size_t, 64> {};
+
+/*
+ * from_decimal_chunks (out[0, size) = digits[0, length) in base 10, most significant digit first)
+ *
+ * Accumulates decimal_chunk<T>::digits digits at a time, so each chunk costs
+ * one multiply-add pass, and only over the limbs that are already in use.
+ */
+template<typename T, typename DIGIT>
+constexpr void from_decimal_chunks(T* out, std::size_t size, const DIGIT* digits, std::size_t length) {
+    for (std::size_t i = 0; i < size; ++i) {
+        out[i] = zero<T>::value;
+    }
+    std::size_t n = 0;
+    std::size_t i = 0;
+    std::size_t take = length % decimal_chunk<T>::digits;
+    if (take == 0) {
+        take = decimal_chunk<T>::digits;
+    }
+    while (i < length) {
+        T chunk = zero<T>::value;
+        T scale = one<T>::value;
+        for (std::size_t j = 0; j < take; ++j) {
+            chunk = static_cast<T>(chunk * 10 + static_cast<T>(digits[i + j]));
+            scale = static_cast<T>(scale * 10);
+        }
+        T carry = chunk;
+        for (std::size_t j = 0; j < n; ++j) {
+            out[j] = multiply_add(out[j], scale, zero<T>::value, carry);
+        }
+        if (carry != zero<T>::value && n < size) {
+            out[n++] = carry;
+        }
+        i += take;
+        take = decimal_chunk<T>::digits;
+    }
+}
+
+/*
+ * make_decimal_power (10^DIGITS, by squaring 10^(DIGITS / 2))
+ */
+template<typename T, std::size_t DIGITS>
+constexpr auto make_decimal_power() {
+    constexpr std::size_t COUNT = required_elements<T, required_bits_radix<10, DIGITS + 1>::value>::value;
+    std::array<T, COUNT> power = {};
+    if constexpr (DIGITS <= decimal_chunk<T>::digits) {
+        power[0] = one<T>::value;
+        for (std::size_t i = 0; i < DIGITS; ++i) {
+            power[0] = static_cast<T>(power[0] * 10);
+        }
+    } else {
+        const auto half = make_decimal_power<T, DIGITS / 2>();
+        std::array<T, 2 * half.size() + 1> square = {};
+        square_limbs<T, half.size(), karatsuba_threshold<T>::value, toom3_threshold<T>::value>(square.data(), half.data());
+        if constexpr (DIGITS % 2 == 1) {
+            T carry = zero<T>::value;
+            for (std::size_t i = 0; i < square.size(); ++i) {
+                square[i] = multiply_add(square[i], ten<T>::value, zero<T>::value, carry);
+            }
+        }
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            power[i] = square[i];
+        }
+    }
+    return power;
+}
+
+/*
+ * decimal_power (10^DIGITS, evaluated once per limb type and exponent)
+ */
+template<typename T, std::size_t DIGITS>
+constexpr auto decimal_power = make_decimal_power<T, DIGITS>();
+
+/*
+ * from_decimal (out[0, size) = digits[0, LENGTH) in base 10)
+ *
+ * Long inputs are split into a high part and a low part of
+ * decimal_chunk<T>::digits * 2^k digits, which are parsed separately and
+ * combined as high * 10^(low digits) + low. Both halves have compile-time
+ * widths, so the recombining multiply goes through multiply_limbs.
+ */
+template<typename T, std::size_t LENGTH, typename DIGIT>
+constexpr void from_decimal(T* out, std::size_t size, const DIGIT* digits) {
+    constexpr std::size_t CHUNK = decimal_chunk<T>::digits;
+    if constexpr (LENGTH <= decimal_split_threshold<T>::value * CHUNK) {
+        from_decimal_chunks(out, size, digits, LENGTH);
+    } else {
+        constexpr std::size_t LOW = [] {
+            std::size_t low = CHUNK;
+            while (2 * low < LENGTH) {
+                low *= 2;
+            }
+            return low;
+        }();
+        constexpr std::size_t HIGH = LENGTH - LOW;
+        constexpr std::size_t HIGH_COUNT = required_elements<T, required_bits_radix<10, HIGH>::value>::value;
+        constexpr std::size_t LOW_COUNT = required_elements<T, required_bits_radix<10, LOW>::value>::value;
+        constexpr auto& power = decimal_power<T, LOW>;
+        constexpr std::size_t POWER_COUNT = power.size();
+
+        std::array<T, HIGH_COUNT> high = {};
+        std::array<T, LOW_COUNT> low = {};
+        from_decimal<T, HIGH>(high.data(), HIGH_COUNT, digits);
+        from_decimal<T, LOW>(low.data(), LOW_COUNT, digits + HIGH);
+
+        std::array<T, HIGH_COUNT + POWER_COUNT> product = {};
+        multiply_limbs<T, HIGH_COUNT, POWER_COUNT, karatsuba_threshold<T>::value, toom3_threshold<T>::value>(
+            product.data(), high.data(), power.data());
+        add_limbs(product.data(), product.data(), product.size(), low.data(), std::min(LOW_COUNT, product.size()));
+        for (std::size_t i = 0; i < size; ++i) {
+            out[i] = i < product.size() ? product[i] : zero<T>::value;
+        }
+    }
+}
+
+/*
+ * radix_conversion_threshold (Used limbs at which base 10 conversion switches to divide-and-conquer)
+ */
+template<typename T>
+struct radix_conversion_threshold : identity<std::size_t, 48> {};
+
+/*
+ * to_decimal_chunks (Writes a[0, n) in base 10, least significant digit first, zero padded to pad)
+ *
+ * Every short division by decimal_chunk<T> peels off a full limb's worth
+ * of digits. a is consumed.
+ */
+template<typename T>
+constexpr std::size_t to_decimal_chunks(char* out, T* a, std::size_t n, std::size_t pad) {
+    std::size_t written = 0;
+    n = used_limbs(a, n);
+    while (n > 0) {
+        T remainder = zero<T>::value;
+        for (std::size_t i = n; i > 0; --i) {
+            a[i - 1] = divide_wide(remainder, a[i - 1], decimal_chunk<T>::value, remainder);
+        }
+        n = used_limbs(a, n);
+        for (std::size_t d = 0; d < decimal_chunk<T>::digits && (n > 0 || remainder != zero<T>::value); ++d) {
+            out[written++] = static_cast<char>(compose_digit<10>(static_cast<char>(remainder % 10)));
+            remainder = static_cast<T>(remainder / 10);
+        }
+    }
+    while (written < pad) {
+        out[written++] = '0';
+    }
+    return written;
+}
+
+/*
+ * to_decimal_split (Divide-and-conquer base 10 conversion over precomputed powers of the chunk)
+ *
+ * powers[k] holds decimal_chunk<T>^(2^k). The value is split by the largest
+ * power of about half its width, and the low half is zero padded to exactly
+ * decimal_chunk<T>::digits * 2^k digits.
+ */
+template<typename T, std::size_t N, std::size_t LEVELS>
+constexpr std::size_t to_decimal_split(
+    char* out,
+    std::array<T, N> a,
+    const std::array<std::array<T, N>, LEVELS>& powers,
+    const std::array<std::size_t, LEVELS>& used,
+    std::size_t levels,
+    std::size_t pad
+) {
+    const std::size_t n = used_limbs(a.data(), N);
+    if (n < radix_conversion_threshold<T>::value || levels == 0) {
+        return to_decimal_chunks(out, a.data(), n, pad);
+    }
+    std::size_t k = 0;
+    while (k + 1 < levels && 2 * used[k + 1] <= n + 1) {
+        ++k;
+    }
+    std::array<T, N> q = {};
+    std::array<T, N> r = {};
+    divide_limbs<T, N, N>(q.data(), r.data(), a.data(), powers[k].data());
+    const std::size_t low = decimal_chunk<T>::digits << k;
+    to_decimal_split(out, r, powers, used, k, low);
+    return low + to_decimal_split(out + low, q, powers, used, levels, pad > low ? pad - low : 0);
+}
+
+/*
+ * to_decimal (Writes a[0, N) in base 10, least significant digit first)
+ */
+template<typename T, std::size_t N>
+constexpr std::size_t to_decimal(char* out, std::array<T, N> a) {
+    if (used_limbs(a.data(), N) < radix_conversion_threshold<T>::value) {
+        return to_decimal_chunks(out, a.data(), N, 0);
+    }
+    constexpr std::size_t LEVELS = [] {
+        std::size_t levels = 1;
+        while ((std::size_t{1} << levels) < N) {
+            ++levels;
+        }
+        return levels + 1;
+    }();
+    std::array<std::array<T, N>, LEVELS> powers = {};
+    std::array<std::size_t, LEVELS> used = {};
+    powers[0][0] = decimal_chunk<T>::value;
+    used[0] = 1;
+    std::size_t levels = 1;
+    while (levels < LEVELS && 2 * used[levels - 1] <= N) {
+        multiply_schoolbook(
+            powers[levels].data(),
+            powers[levels - 1].data(), used[levels - 1],
+            powers[levels - 1].data(), used[levels - 1]);
+        used[levels] = used_limbs(powers[levels].data(), N);
+        ++levels;
+    }
+    return to_decimal_split(out, a, powers, used, levels, 0);
+}
+
 } //namespace impl
 
 /*
@@ -113,147 +1438,536 @@ struct bigint :
     static constexpr std::size_t bits = BITS;
     static constexpr std::size_t count = impl::required_elements<T, BITS>::value;
 
-    constexpr std::size_t highest_bit() const {
-        std::size_t i = count - 1;
-        while (i > 0 && this->at(i) == 0) {
-            i--;
-        }
+    /*
+     * highest_bit (One-based position of the highest set bit, zero for zero)
+     *
+     * used bounds the limbs in use, so callers that track it skip the zero
+     * high limbs of a mostly empty wide value.
+     */
+    constexpr std::size_t highest_bit(std::size_t used = count) const {
+        const std::size_t n = impl::used_limbs(this->data(), used);
+        if (n == 0) {
+            return 0;
+        }
+        return n * std::numeric_limits<T>::digits - impl::count_leading_zeros((*this)[n - 1]);
+    }
+
+    /*
+     * used_limbs (Number of limbs up to the highest non-zero limb)
+     */
+    constexpr std::size_t used_limbs(std::size_t used = count) const {
+        return impl::used_limbs(this->data(), used);
+    }
+
+    /*
+     * lowest_bit (One-based position of the lowest set bit, zero for zero)
+     */
+    constexpr std::size_t lowest_bit() const {
+        for (std::size_t i = 0; i < count; ++i) {
+            if ((*this)[i] != zero<T>::value) {
+                return i * std::numeric_limits<T>::digits + impl::count_trailing_zeros((*this)[i]) + 1;
+            }
+        }
+        return 0;
+    }
+
+    /*
+     * popcount (Number of set bits)
+     */
+    constexpr std::size_t popcount() const {
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            n += impl::count_ones((*this)[i]);
+        }
+        return n;
+    }
+
+    /*
+     * test_bit, set_bit and clear_bit (Zero-based bit index below count * digits)
+     */
+    constexpr bool test_bit(std::size_t bit) const {
+        constexpr std::size_t DIGITS = std::numeric_limits<T>::digits;
+        return ((*this)[bit / DIGITS] >> (bit % DIGITS) & one<T>::value) != zero<T>::value;
+    }
+
+    constexpr void set_bit(std::size_t bit) {
+        constexpr std::size_t DIGITS = std::numeric_limits<T>::digits;
+        (*this)[bit / DIGITS] = static_cast<T>((*this)[bit / DIGITS] | static_cast<T>(one<T>::value << (bit % DIGITS)));
+    }
+
+    constexpr void clear_bit(std::size_t bit) {
+        constexpr std::size_t DIGITS = std::numeric_limits<T>::digits;
+        (*this)[bit / DIGITS] = static_cast<T>((*this)[bit / DIGITS] & static_cast<T>(~(one<T>::value << (bit % DIGITS))));
+    }
+};
+
+/*
+ * add
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto add(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    constexpr std::size_t BITS = impl::required_bits_addition<T, A_BITS, B_BITS>::value;
+    constexpr std::size_t N = std::max(bigint<A_BITS, T>::count, bigint<B_BITS, T>::count);
+    bigint<BITS, T> result = {};
+    for (std::size_t i = 0; i < a.count; ++i) {
+        result[i] = a[i];
+    }
+    const T carry = impl::add_limbs(result.data(), result.data(), N, b.data(), b.count);
+    if constexpr (N < result.count) {
+        result[N] = carry;
+    }
+    return result;
+}
+
+/*
+ * add_in_place
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto add_in_place(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    constexpr std::size_t BITS = std::max(A_BITS, B_BITS);
+    bigint<BITS, T> result = {};
+    for (std::size_t i = 0; i < a.count; ++i) {
+        result[i] = a[i];
+    }
+    impl::add_limbs(result.data(), result.data(), result.count, b.data(), b.count);
+    return result;
+}
+
+/*
+ * subtract (Wraps modulo the limb width when b > a, like the built-in unsigned types)
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto subtract(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    constexpr std::size_t BITS = impl::required_bits_subtraction<T, A_BITS, B_BITS>::value;
+    bigint<BITS, T> result = {};
+    for (std::size_t i = 0; i < a.count; ++i) {
+        result[i] = a[i];
+    }
+    impl::subtract_limbs(result.data(), result.data(), result.count, b.data(), b.count);
+    return result;
+}
+
+/*
+ * multiply
+ */
+template<
+    typename T,
+    std::size_t A_BITS,
+    std::size_t B_BITS,
+    std::size_t KARATSUBA_THRESHOLD = impl::karatsuba_threshold<T>::value,
+    std::size_t TOOM3_THRESHOLD = impl::toom3_threshold<T>::value
+>
+constexpr auto multiply(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    constexpr std::size_t A_COUNT = bigint<A_BITS, T>::count;
+    constexpr std::size_t B_COUNT = bigint<B_BITS, T>::count;
+    bigint<impl::required_bits_multiplication<T, A_BITS, B_BITS>::value, T> result = { zero<T>::value };
+    std::array<T, A_COUNT + B_COUNT> product = {};
+    // Mostly empty operands take schoolbook over their used limbs rather than the full width algorithm
+    const std::size_t a_used = a.used_limbs();
+    const std::size_t b_used = b.used_limbs();
+    if (std::min(a_used, b_used) < KARATSUBA_THRESHOLD) {
+        impl::multiply_schoolbook(product.data(), a.data(), a_used, b.data(), b_used);
+    } else {
+        impl::multiply_limbs<T, A_COUNT, B_COUNT, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(product.data(), a.data(), b.data());
+    }
+    for (std::size_t i = 0; i < result.count; ++i) {
+        result[i] = product[i];
+    }
+    return result;
+}
+
+/*
+ * multiply_in_place
+ */
+template<
+    typename T,
+    std::size_t MAX_BITS,
+    std::size_t OTHER_BITS,
+    std::size_t KARATSUBA_THRESHOLD = impl::karatsuba_threshold<T>::value,
+    std::size_t TOOM3_THRESHOLD = impl::toom3_threshold<T>::value
+>
+constexpr auto multiply_in_place(const bigint<MAX_BITS, T>& a, const bigint<OTHER_BITS, T>& b) {
+    constexpr std::size_t A_COUNT = bigint<MAX_BITS, T>::count;
+    constexpr std::size_t B_COUNT = bigint<OTHER_BITS, T>::count;
+    bigint<MAX_BITS, T> result = { zero<T>::value };
+    const std::size_t a_used = a.used_limbs();
+    const std::size_t b_used = b.used_limbs();
+    if (std::min(A_COUNT, B_COUNT) < KARATSUBA_THRESHOLD || std::min(a_used, b_used) < KARATSUBA_THRESHOLD) {
+        // Schoolbook over the used limbs, skipping the partial products that fall outside of the result.
+        for (std::size_t bi = 0; bi < b_used && bi < result.count; ++bi) {
+            const auto count = std::min(a_used, result.count - bi);
+            const T k = impl::multiply_add_row(result.data() + bi, a.data(), count, b[bi]);
+            if (bi + count < result.count) {
+                result[bi + count] = k;
+            }
+        }
+    } else {
+        std::array<T, A_COUNT + B_COUNT> product = {};
+        impl::multiply_limbs<T, A_COUNT, B_COUNT, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(product.data(), a.data(), b.data());
+        for (std::size_t i = 0; i < result.count; ++i) {
+            result[i] = product[i];
+        }
+    }
+    return result;
+}
+
+/*
+ * square
+ */
+template<
+    typename T,
+    std::size_t BITS,
+    std::size_t KARATSUBA_THRESHOLD = impl::karatsuba_threshold<T>::value,
+    std::size_t TOOM3_THRESHOLD = impl::toom3_threshold<T>::value
+>
+constexpr auto square(const bigint<BITS, T>& a) {
+    constexpr std::size_t COUNT = bigint<BITS, T>::count;
+    bigint<impl::required_bits_multiplication<T, BITS, BITS>::value, T> result = { zero<T>::value };
+    std::array<T, 2 * COUNT> product = {};
+    impl::square_limbs<T, COUNT, KARATSUBA_THRESHOLD, TOOM3_THRESHOLD>(product.data(), a.data());
+    for (std::size_t i = 0; i < result.count; ++i) {
+        result[i] = product[i];
+    }
+    return result;
+}
+
+/*
+ * divmod_result
+ */
+template<typename Q, typename R>
+struct divmod_result {
+    Q quotient;
+    R remainder;
+};
+
+/*
+ * divmod (Quotient and remainder from one long division pass, b must be non-zero)
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto divmod(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    divmod_result<bigint<A_BITS, T>, bigint<B_BITS, T>> result = {};
+    impl::divide_limbs<T, bigint<A_BITS, T>::count, bigint<B_BITS, T>::count>(
+        result.quotient.data(), result.remainder.data(), a.data(), b.data());
+    return result;
+}
+
+/*
+ * divide
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto divide(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return divmod(a, b).quotient;
+}
+
+/*
+ * modulo
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto modulo(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return divmod(a, b).remainder;
+}
+
+/*
+ * '+' (Addition Operators)
+ */
+template<std::size_t BITS, typename T>
+constexpr auto operator+(const bigint<BITS, T>& a, T b) {
+    bigint<std::numeric_limits<T>::digits, T> bb = {b };
+    return add(a, bb);
+}
+
+template<std::size_t BITS, typename T>
+constexpr auto operator+(const bigint<BITS, T>& a, const bigint<BITS, T>& b) {
+    return add(a, b);
+}
+
+/*
+ * '*' (Multiplication Operators)
+ */
+template<std::size_t BITS, typename T>
+constexpr auto operator*(const bigint<BITS, T>& a, T b) {
+    bigint<std::numeric_limits<T>::digits, T> bb = {b };
+    return multiply(a, bb);
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto operator*(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    if constexpr (A_BITS == B_BITS) {
+        if (&a == &b) {
+            return square(a);
+        }
+    }
+    return multiply(a, b);
+}
+
+/*
+ * '-' (Subtraction Operators)
+ */
+template<std::size_t BITS, typename T>
+constexpr auto operator-(const bigint<BITS, T>& a, T b) {
+    bigint<std::numeric_limits<T>::digits, T> bb = {b };
+    return subtract(a, bb);
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto operator-(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return subtract(a, b);
+}
+
+/*
+ * '/' (Division Operators)
+ */
+template<std::size_t BITS, typename T>
+constexpr auto operator/(const bigint<BITS, T>& a, T b) {
+    bigint<std::numeric_limits<T>::digits, T> bb = {b };
+    return divide(a, bb);
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto operator/(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return divide(a, b);
+}
+
+/*
+ * '%' (Modulo Operators)
+ */
+template<std::size_t BITS, typename T>
+constexpr auto operator%(const bigint<BITS, T>& a, T b) {
+    bigint<std::numeric_limits<T>::digits, T> bb = {b };
+    return modulo(a, bb);
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto operator%(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return modulo(a, b);
+}
+
+/*
+ * shift_left (a << SHIFT, widened by SHIFT bits so nothing is lost)
+ */
+template<std::size_t SHIFT, typename T, std::size_t BITS>
+constexpr auto shift_left(const bigint<BITS, T>& a) {
+    bigint<impl::required_bits_shift_left<T, BITS, SHIFT>::value, T> result = {};
+    impl::shift_left_limbs(result.data(), result.count, a.data(), a.count, SHIFT);
+    return result;
+}
+
+/*
+ * shift_right (a >> SHIFT, narrowed by SHIFT bits)
+ */
+template<std::size_t SHIFT, typename T, std::size_t BITS>
+constexpr auto shift_right(const bigint<BITS, T>& a) {
+    bigint<impl::required_bits_shift_right<T, BITS, SHIFT>::value, T> result = {};
+    impl::shift_right_limbs(result.data(), result.count, a.data(), a.count, SHIFT);
+    return result;
+}
+
+/*
+ * '<<' and '>>' (Shift Operators)
+ *
+ * A shift by identity<std::size_t, K> changes the width like shift_left and
+ * shift_right. A shift by a runtime count keeps the width, and a left shift
+ * wraps modulo 2^BITS like the built-in unsigned types.
+ */
+template<std::size_t BITS, typename T, std::size_t SHIFT>
+constexpr auto operator<<(const bigint<BITS, T>& a, identity<std::size_t, SHIFT>) {
+    return shift_left<SHIFT>(a);
+}
 
-        std::size_t j = std::numeric_limits<T>::digits;
-        while (j > 0 && (this->at(i) & (0x01 << (j - 1))) == 0) {
-            j--;
-        }
-        return i * std::numeric_limits<T>::digits + j;
-    }
-};
+template<std::size_t BITS, typename T, std::size_t SHIFT>
+constexpr auto operator>>(const bigint<BITS, T>& a, identity<std::size_t, SHIFT>) {
+    return shift_right<SHIFT>(a);
+}
+
+template<std::size_t BITS, typename T>
+constexpr bigint<BITS, T> operator<<(const bigint<BITS, T>& a, std::size_t shift) {
+    bigint<BITS, T> result = {};
+    impl::shift_left_limbs(result.data(), result.count, a.data(), a.count, shift);
+    result[result.count - 1] = static_cast<T>(result[result.count - 1] & impl::top_limb_mask<T, BITS>::value);
+    return result;
+}
+
+template<std::size_t BITS, typename T>
+constexpr bigint<BITS, T> operator>>(const bigint<BITS, T>& a, std::size_t shift) {
+    bigint<BITS, T> result = {};
+    impl::shift_right_limbs(result.data(), result.count, a.data(), a.count, shift);
+    return result;
+}
 
 /*
- * add
+ * '&' (Bitwise And, as wide as the narrower operand)
  */
 template<typename T, std::size_t A_BITS, std::size_t B_BITS>
-constexpr auto add(bigint<A_BITS, T> a, bigint<B_BITS, T> b) {
-    constexpr std::size_t BITS = impl::required_bits_addition<T, A_BITS, B_BITS>::value;
-    std::array<T, impl::required_elements<T, BITS>::value> result = {};
-    T carry = { zero<T>::value };
-    for (std::size_t i = 0; i < result.size() - 1; i++) {
-        T ai = i < a.count ? a[i] : zero<T>::value;
-        T bi = i < b.count ? b[i] : zero<T>::value;
-        T current = ai + bi;
-        T partial = current + carry;
-        carry = (current < ai) || (partial < current) ? one<T>::value : zero<T>::value;
-        result[i] = partial;
-    }
-    result[result.size() - 1] = carry;
-    return bigint<BITS, T>{ result };
+constexpr auto operator&(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    bigint<std::min(A_BITS, B_BITS), T> result = {};
+    for (std::size_t i = 0; i < result.count; ++i) {
+        result[i] = static_cast<T>(a[i] & b[i]);
+    }
+    return result;
 }
 
 /*
- * add_in_place
+ * '|' (Bitwise Or, as wide as the wider operand)
  */
 template<typename T, std::size_t A_BITS, std::size_t B_BITS>
-constexpr auto add_in_place(bigint<A_BITS, T> a, bigint<B_BITS, T> b) {
-    constexpr std::size_t BITS = std::max(A_BITS, B_BITS);
-    std::array<T, impl::required_elements<T, BITS>::value> result = {};
-    T carry = { zero<T>::value };
-    for (std::size_t i = 0; i < result.size(); i++) {
-        T ai = i < a.count ? a[i] : zero<T>::value;
-        T bi = i < b.count ? b[i] : zero<T>::value;
-        T current = ai + bi;
-        T partial = current + carry;
-        carry = (current < ai) || (partial < current) ? one<T>::value : zero<T>::value;
-        result[i] = partial;
+constexpr auto operator|(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    bigint<std::max(A_BITS, B_BITS), T> result = {};
+    for (std::size_t i = 0; i < result.count; ++i) {
+        const T ai = i < a.count ? a[i] : zero<T>::value;
+        const T bi = i < b.count ? b[i] : zero<T>::value;
+        result[i] = static_cast<T>(ai | bi);
     }
-    return bigint<BITS, T>{ result };
+    return result;
 }
 
 /*
- * multiply
+ * '^' (Bitwise Exclusive Or, as wide as the wider operand)
  */
 template<typename T, std::size_t A_BITS, std::size_t B_BITS>
-constexpr auto multiply(bigint<A_BITS, T> a, bigint<B_BITS, T> b) {
-    using OverflowType = typename impl::bigint_datatype<T>::overflow_type;
-    bigint<impl::required_bits_multiplication<T, A_BITS, B_BITS>::value, T> result = { zero<T>::value };
-    for (auto bi = 0; bi < b.count; ++bi) {
-        T k = 0;
-        const auto count = std::min(a.count, result.count - bi);
-        for (auto ai = 0; ai < count; ++ai) {
-            OverflowType product = multiply(
-            static_cast<OverflowType>(a[ai]),
-            static_cast<OverflowType>(b[bi]));
-            OverflowType partial = add(
-            static_cast<OverflowType>(result[ai + bi]),
-            static_cast<OverflowType>(k));
-            OverflowType sum = add(partial, product);
-            result[ai + bi] = static_cast<T>(sum);
-            k = sum >> static_cast<T>(std::numeric_limits<T>::digits);
-        }
-        if (bi + count < result.count) {
-            result[bi + count] = k;
-        }
+constexpr auto operator^(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    bigint<std::max(A_BITS, B_BITS), T> result = {};
+    for (std::size_t i = 0; i < result.count; ++i) {
+        const T ai = i < a.count ? a[i] : zero<T>::value;
+        const T bi = i < b.count ? b[i] : zero<T>::value;
+        result[i] = static_cast<T>(ai ^ bi);
     }
     return result;
 }
 
 /*
- * multiply_in_place
+ * '~' (Bitwise Complement of the BITS value bits)
  */
-template<typename T, std::size_t MAX_BITS, std::size_t OTHER_BITS>
-constexpr auto multiply_in_place(bigint<MAX_BITS, T> a, bigint<OTHER_BITS, T> b) {
-    using OverflowType = typename impl::bigint_datatype<T>::overflow_type;
-    bigint<MAX_BITS, T> result = { zero<T>::value };
-    for (auto bi = 0; bi < b.count; ++bi) {
-        T k = 0;
-        const auto count = std::min(a.count, result.count - bi);
-        for (auto ai = 0; ai < count; ++ai) {
-            OverflowType product = multiply(
-            static_cast<OverflowType>(a[ai]),
-            static_cast<OverflowType>(b[bi]));
-            OverflowType partial = add(
-            static_cast<OverflowType>(result[ai + bi]),
-            static_cast<OverflowType>(k));
-            OverflowType sum = add(partial, product);
-            result[ai + bi] = static_cast<T>(sum);
-            k = sum >> static_cast<T>(std::numeric_limits<T>::digits);
-        }
-        if (bi + count < result.count) {
-            result[bi + count] = k;
-        }
+template<std::size_t BITS, typename T>
+constexpr bigint<BITS, T> operator~(const bigint<BITS, T>& a) {
+    bigint<BITS, T> result = {};
+    for (std::size_t i = 0; i < result.count; ++i) {
+        result[i] = static_cast<T>(~a[i]);
     }
+    result[result.count - 1] = static_cast<T>(result[result.count - 1] & impl::top_limb_mask<T, BITS>::value);
     return result;
 }
 
 /*
- * '+' (Addition Operators)
+ * '+=' and '-=' (Compound Addition and Subtraction, in the limbs of a)
+ *
+ * Like add_in_place and subtract, the result wraps modulo the limb width of a.
  */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bigint<A_BITS, T>& operator+=(bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    constexpr std::size_t N = std::min(bigint<A_BITS, T>::count, bigint<B_BITS, T>::count);
+    const T carry = impl::add_limbs(a.data(), a.data(), N, b.data(), N);
+    impl::increment_limbs(a.data() + N, a.count - N, carry);
+    return a;
+}
+
 template<std::size_t BITS, typename T>
-constexpr auto operator+(bigint<BITS, T> a, T b) {
-    bigint<std::numeric_limits<T>::digits, T> bb = {b };
-    return add(a, bb);
+constexpr bigint<BITS, T>& operator+=(bigint<BITS, T>& a, T b) {
+    impl::increment_limbs(a.data(), a.count, b);
+    return a;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bigint<A_BITS, T>& operator-=(bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    constexpr std::size_t N = std::min(bigint<A_BITS, T>::count, bigint<B_BITS, T>::count);
+    const T borrow = impl::subtract_limbs(a.data(), a.data(), N, b.data(), N);
+    impl::decrement_limbs(a.data() + N, a.count - N, borrow);
+    return a;
 }
 
 template<std::size_t BITS, typename T>
-constexpr auto operator+(bigint<BITS, T> a, bigint<BITS, T> b) {
-    return add(a, b);
+constexpr bigint<BITS, T>& operator-=(bigint<BITS, T>& a, T b) {
+    impl::decrement_limbs(a.data(), a.count, b);
+    return a;
 }
 
 /*
- * '*' (Multiplication Operators)
+ * '*=' (Compound Multiplication, in the limbs of a and wrapping modulo their width)
+ *
+ * Rows run from the top limb of a down, so each limb of a is read before
+ * any row writes to it. When b is a itself it is copied first; operands
+ * wide enough for Karatsuba take multiply_in_place instead.
  */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bigint<A_BITS, T>& operator*=(bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    const std::size_t a_used = a.used_limbs();
+    const std::size_t b_used = b.used_limbs();
+    if (std::min(a_used, b_used) >= impl::karatsuba_threshold<T>::value) {
+        a = multiply_in_place(a, b);
+        return a;
+    }
+    if (static_cast<const void*>(&a) == static_cast<const void*>(&b)) {
+        const bigint<B_BITS, T> copy = b;
+        return a *= copy;
+    }
+    for (std::size_t i = a_used; i > 0; --i) {
+        const std::size_t row = i - 1;
+        const T limb = a[row];
+        a[row] = zero<T>::value;
+        const std::size_t length = std::min(b_used, a.count - row);
+        const T carry = impl::multiply_add_row(a.data() + row, b.data(), length, limb);
+        impl::increment_limbs(a.data() + row + length, a.count - row - length, carry);
+    }
+    return a;
+}
+
 template<std::size_t BITS, typename T>
-constexpr auto operator*(bigint<BITS, T> a, T b) {
-    bigint<std::numeric_limits<T>::digits, T> bb = {b };
-    return multiply(a, bb);
+constexpr bigint<BITS, T>& operator*=(bigint<BITS, T>& a, T b) {
+    T carry = zero<T>::value;
+    for (std::size_t i = 0; i < a.count; ++i) {
+        a[i] = impl::multiply_add(a[i], b, zero<T>::value, carry);
+    }
+    return a;
 }
 
-template<typename T, std::size_t A_BITS, std::size_t B_BITS>
-constexpr auto operator*(bigint<A_BITS, T> a, bigint<B_BITS, T> b) {
-    return multiply(a, b);
+/*
+ * multiply_accumulate (acc += b * c, wrapping modulo the limb width of acc)
+ *
+ * Adds each row of the product straight into acc instead of forming b * c
+ * first. acc may be b or c, in which case the product is formed first.
+ */
+template<typename T, std::size_t ACC_BITS, std::size_t B_BITS, std::size_t C_BITS>
+constexpr bigint<ACC_BITS, T>& multiply_accumulate(bigint<ACC_BITS, T>& acc, const bigint<B_BITS, T>& b, const bigint<C_BITS, T>& c) {
+    const std::size_t b_used = b.used_limbs();
+    const std::size_t c_used = c.used_limbs();
+    if (static_cast<const void*>(&acc) == static_cast<const void*>(&b)
+        || static_cast<const void*>(&acc) == static_cast<const void*>(&c)
+        || std::min(b_used, c_used) >= impl::karatsuba_threshold<T>::value) {
+        return acc += multiply(b, c);
+    }
+    for (std::size_t j = 0; j < c_used && j < acc.count; ++j) {
+        const std::size_t length = std::min(b_used, acc.count - j);
+        const T carry = impl::multiply_add_row(acc.data() + j, b.data(), length, c[j]);
+        impl::increment_limbs(acc.data() + j + length, acc.count - j - length, carry);
+    }
+    return acc;
 }
 
 /*
- * ++ (Increment Operator)
+ * '++' and '--' (Increment and Decrement Operators, wrapping like '+=' and '-=')
  */
-// TODO
+template<std::size_t BITS, typename T>
+constexpr bigint<BITS, T>& operator++(bigint<BITS, T>& a) {
+    return a += one<T>::value;
+}
+
+template<std::size_t BITS, typename T>
+constexpr bigint<BITS, T> operator++(bigint<BITS, T>& a, int) {
+    const bigint<BITS, T> previous = a;
+    a += one<T>::value;
+    return previous;
+}
+
+template<std::size_t BITS, typename T>
+constexpr bigint<BITS, T>& operator--(bigint<BITS, T>& a) {
+    return a -= one<T>::value;
+}
+
+template<std::size_t BITS, typename T>
+constexpr bigint<BITS, T> operator--(bigint<BITS, T>& a, int) {
+    const bigint<BITS, T> previous = a;
+    a -= one<T>::value;
+    return previous;
+}
 
 /*
  * zero
@@ -299,7 +2013,7 @@ struct ten<bigint<BITS, V>> {
  * of
  */
 template<typename T, std::size_t INPUT_BITS, std::size_t OUTPUT_BITS>
-constexpr bigint<OUTPUT_BITS, T> of(bigint<INPUT_BITS, T> a) {
+constexpr bigint<OUTPUT_BITS, T> of(const bigint<INPUT_BITS, T>& a) {
     bigint<OUTPUT_BITS, T> value = {  };
     for (std::size_t i = 0; i < a.count; i++) {
         value[i] = a[i];
@@ -308,23 +2022,43 @@ constexpr bigint<OUTPUT_BITS, T> of(bigint<INPUT_BITS, T> a) {
 }
 
 /*
- * '==' (Equality Operator)
+ * compare (Three-way comparison: negative, zero or positive as a < b, a == b or a > b)
+ *
+ * Limbs the wider operand has beyond the narrower one are checked for zero
+ * first, then the common limbs from the top down, stopping at the first
+ * that differs.
  */
 template<typename T, std::size_t A_BITS, std::size_t B_BITS>
-constexpr bool operator==(bigint<A_BITS, T> a, bigint<B_BITS, T> b) {
-    constexpr auto count = std::max(a.count, b.count);
-    for (std::size_t i = 0; i < count; ++i) {
-        T ai = i < a.count ? a[i] : zero<T>::value;
-        T bi = i < b.count ? b[i] : zero<T>::value;
-        if (is_not_equal(ai, bi)) {
-            return false;
+constexpr int compare(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    constexpr std::size_t N = std::min(bigint<A_BITS, T>::count, bigint<B_BITS, T>::count);
+    for (std::size_t i = a.count; i > N; --i) {
+        if (a[i - 1] != zero<T>::value) {
+            return 1;
         }
     }
-    return true;
+    for (std::size_t i = b.count; i > N; --i) {
+        if (b[i - 1] != zero<T>::value) {
+            return -1;
+        }
+    }
+    return impl::compare_limbs(a.data(), b.data(), N);
+}
+
+/*
+ * '==' and '!=' (Equality Operators)
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator==(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return compare(a, b) == 0;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator!=(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return compare(a, b) != 0;
 }
 
 template<std::size_t BITS, typename T>
-constexpr bool operator==(bigint<BITS, T> a, T b) {
+constexpr bool operator==(const bigint<BITS, T>& a, T b) {
     if (is_not_equal<T>(a[0], b)) {
         return false;
     }
@@ -336,25 +2070,32 @@ constexpr bool operator==(bigint<BITS, T> a, T b) {
     return true;
 }
 
+template<std::size_t BITS, typename T>
+constexpr bool operator!=(const bigint<BITS, T>& a, T b) {
+    return !(a == b);
+}
+
 /*
- * '<=' (Less Than or Equal Operator)
+ * '<', '<=', '>' and '>=' (Relational Operators)
  */
 template<typename T, std::size_t A_BITS, std::size_t B_BITS>
-constexpr bool operator<=(bigint<A_BITS, T> a, bigint<B_BITS, T> b) {
-    constexpr auto count = std::max(a.count, b.count);
-    for (std::size_t i = count; i > 0; --i) {
-        std::size_t j = i - 1;
-        T aj = j < a.count ? a[j] : zero<T>::value;
-        T bj = j < b.count ? b[j] : zero<T>::value;
-        if (is_equal(aj, bj)) {
-            continue;
-        } else if (is_less(aj, bj)) {
-            return true;
-        } else {
-            return false;
-        }
-    }
-    return true;
+constexpr bool operator<(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return compare(a, b) < 0;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator<=(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return compare(a, b) <= 0;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator>(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return compare(a, b) > 0;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator>=(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    return compare(a, b) >= 0;
 }
 
 /*
@@ -362,47 +2103,335 @@ constexpr bool operator<=(bigint<A_BITS, T> a, bigint<B_BITS, T> b) {
  */
 template<typename T, std::uint8_t RADIX = 10, typename DIGIT = std::uint8_t, std::size_t INPUT_LENGTH>
 constexpr auto from_digits(const std::array<DIGIT, INPUT_LENGTH> digits) {
-    using OverflowType = typename impl::bigint_datatype<T>::overflow_type;
     constexpr auto BITS = impl::required_bits_radix<RADIX, INPUT_LENGTH>::value;
 
     std::array<T, impl::required_elements<T, BITS>::value> result = {};
-    for (std::size_t i = 0; i < INPUT_LENGTH; ++i) {
-        OverflowType carry = zero<OverflowType>::value;
-        for (std::size_t j = 0; j < result.size(); ++j) {
-            OverflowType product = add(multiply(static_cast<OverflowType>(result[j]), static_cast<OverflowType>(RADIX)),
-                                       carry);
-            OverflowType low = product & std::numeric_limits<T>::max();
-            carry = product >> std::numeric_limits<T>::digits;
-            result[j] = low;
-        }
-        carry = digits[i];
-        for (std::size_t j = 0; j < result.size(); ++j) {
-            OverflowType sum = add(static_cast<OverflowType>(result[j]), carry);
-            OverflowType low = sum & std::numeric_limits<T>::max();
-            carry = sum >> std::numeric_limits<T>::digits;
-            result[j] = low;
+    if constexpr (impl::radix_digit_bits<RADIX>::value > 0) {
+        // Power-of-two radix: every digit is a fixed-width bit field, shift it straight into place.
+        constexpr int DIGIT_BITS = impl::radix_digit_bits<RADIX>::value;
+        constexpr int LIMB_BITS = std::numeric_limits<T>::digits;
+        for (std::size_t i = 0; i < INPUT_LENGTH; ++i) {
+            const T digit = static_cast<T>(digits[INPUT_LENGTH - 1 - i]);
+            const std::size_t bit = i * DIGIT_BITS;
+            const std::size_t limb = bit / LIMB_BITS;
+            const int offset = static_cast<int>(bit % LIMB_BITS);
+            result[limb] = static_cast<T>(result[limb] | static_cast<T>(digit << offset));
+            if (offset + DIGIT_BITS > LIMB_BITS) {
+                result[limb + 1] = static_cast<T>(result[limb + 1] | static_cast<T>(digit >> (LIMB_BITS - offset)));
+            }
+        }
+    } else if constexpr (RADIX == 10) {
+        impl::from_decimal<T, INPUT_LENGTH>(result.data(), result.size(), digits.data());
+    } else {
+        for (std::size_t i = 0; i < INPUT_LENGTH; ++i) {
+            T carry = static_cast<T>(digits[i]);
+            for (std::size_t j = 0; j < result.size(); ++j) {
+                result[j] = impl::multiply_add(result[j], static_cast<T>(RADIX), zero<T>::value, carry);
+            }
         }
     }
     return bigint<BITS, T>{ result };
 }
 
 /*
- * logarithm
+ * parse_result
+ */
+template<typename V>
+struct parse_result {
+    V value;
+    std::errc error;
+    std::size_t position;
+};
+
+/*
+ * parse (Runtime text to bigint, most significant digit first, no prefix or sign)
+ *
+ * error is std::errc{} on success, std::errc::invalid_argument for empty
+ * text or a character that is not a RADIX digit (position is its index),
+ * and std::errc::result_out_of_range when the value needs more than BITS
+ * bits. The value is zero whenever error is set.
+ */
+template<std::size_t BITS = impl::default_bits<std::size_t>::value, typename T = std::uint32_t, std::uint8_t RADIX = 10>
+constexpr parse_result<bigint<BITS, T>> parse(std::string_view text) {
+    constexpr int LIMB_BITS = std::numeric_limits<T>::digits;
+    parse_result<bigint<BITS, T>> result = { {}, std::errc{}, 0 };
+    auto fail = [&result](std::errc error, std::size_t position) {
+        result = { {}, error, position };
+        return result;
+    };
+    if (text.empty()) {
+        return fail(std::errc::invalid_argument, 0);
+    }
+    auto& value = result.value;
+
+    if constexpr (impl::radix_digit_bits<RADIX>::value > 0) {
+        constexpr int DIGIT_BITS = impl::radix_digit_bits<RADIX>::value;
+        std::array<std::uint8_t, 64> digits = {};
+        for (std::size_t i = 0; i < text.size(); i += digits.size()) {
+            const std::size_t length = std::min(text.size() - i, digits.size());
+            const std::size_t valid = parse_digits<RADIX>(text.substr(i, length), digits.data());
+            if (valid != length) {
+                return fail(std::errc::invalid_argument, i + valid);
+            }
+            for (std::size_t j = 0; j < length; ++j) {
+                const T digit = static_cast<T>(digits[j]);
+                if (digit == zero<T>::value) {
+                    continue;
+                }
+                const std::size_t index = i + j;
+                const std::size_t bit = (text.size() - 1 - index) * DIGIT_BITS;
+                if (bit + static_cast<std::size_t>(LIMB_BITS - impl::count_leading_zeros(digit)) > BITS) {
+                    return fail(std::errc::result_out_of_range, index);
+                }
+                const std::size_t limb = bit / LIMB_BITS;
+                const int offset = static_cast<int>(bit % LIMB_BITS);
+                value[limb] = static_cast<T>(value[limb] | static_cast<T>(digit << offset));
+                if (offset + DIGIT_BITS > LIMB_BITS) {
+                    value[limb + 1] = static_cast<T>(value[limb + 1] | static_cast<T>(digit >> (LIMB_BITS - offset)));
+                }
+            }
+        }
+    } else {
+        static_assert(RADIX == 10, "Unsupported radix");
+        constexpr std::size_t CHUNK = impl::decimal_chunk<T>::digits;
+        // Whole chunks per block, so the first (short) chunk never straddles two blocks
+        std::array<std::uint8_t, CHUNK * (64 / CHUNK)> digits = {};
+        std::size_t n = 0;
+        std::size_t i = 0;
+        std::size_t take = text.size() % CHUNK == 0 ? CHUNK : text.size() % CHUNK;
+        while (i < text.size()) {
+            const std::size_t length = std::min(text.size() - i, take + digits.size() - CHUNK);
+            const std::size_t valid = parse_digits<RADIX>(text.substr(i, length), digits.data());
+            if (valid != length) {
+                return fail(std::errc::invalid_argument, i + valid);
+            }
+            for (std::size_t k = 0; k < length; k += take, take = CHUNK) {
+                T chunk = zero<T>::value;
+                T scale = one<T>::value;
+                for (std::size_t j = k; j < k + take; ++j) {
+                    chunk = static_cast<T>(chunk * 10 + static_cast<T>(digits[j]));
+                    scale = static_cast<T>(scale * 10);
+                }
+                T carry = chunk;
+                for (std::size_t j = 0; j < n; ++j) {
+                    value[j] = impl::multiply_add(value[j], scale, zero<T>::value, carry);
+                }
+                if (carry != zero<T>::value) {
+                    if (n == value.count) {
+                        return fail(std::errc::result_out_of_range, i + k + take - 1);
+                    }
+                    value[n++] = carry;
+                }
+            }
+            i += length;
+        }
+        if (n > 0 && n * LIMB_BITS - impl::count_leading_zeros(value[n - 1]) > BITS) {
+            return fail(std::errc::result_out_of_range, text.size() - 1);
+        }
+    }
+    return result;
+}
+
+/*
+ * to_digits (Least significant digit first, unused digits are zero)
+ */
+template<std::uint8_t RADIX = 10, typename T, std::size_t BITS>
+constexpr auto to_digits(const bigint<BITS, T>& v) {
+    constexpr std::size_t STORAGE_BITS = bigint<BITS, T>::count * std::numeric_limits<T>::digits;
+    std::array<char, impl::required_digits_bits<RADIX, STORAGE_BITS>::value> digits = {};
+    if constexpr (RADIX == 10) {
+        impl::to_decimal(digits.data(), static_cast<const std::array<T, bigint<BITS, T>::count>&>(v));
+    } else {
+        constexpr int DIGIT_BITS = impl::radix_digit_bits<RADIX>::value;
+        static_assert(DIGIT_BITS > 0, "Unsupported radix");
+        constexpr int LIMB_BITS = std::numeric_limits<T>::digits;
+        const std::size_t n = impl::used_limbs(v.data(), v.count);
+        const std::size_t used_bits = n == 0 ? 0 : n * LIMB_BITS - impl::count_leading_zeros(v[n - 1]);
+        for (std::size_t i = 0; i * DIGIT_BITS < used_bits; ++i) {
+            const std::size_t bit = i * DIGIT_BITS;
+            const std::size_t limb = bit / LIMB_BITS;
+            const int offset = static_cast<int>(bit % LIMB_BITS);
+            T digit = static_cast<T>(v[limb] >> offset);
+            if (offset + DIGIT_BITS > LIMB_BITS && limb + 1 < v.count) {
+                digit = static_cast<T>(digit | (v[limb + 1] << (LIMB_BITS - offset)));
+            }
+            digits[i] = static_cast<char>(compose_digit<RADIX>(static_cast<std::uint8_t>(digit & (RADIX - 1))));
+        }
+    }
+    return digits;
+}
+
+/*
+ * to_string (Most significant digit first, "0" for zero)
+ */
+template<std::uint8_t RADIX = 10, typename T, std::size_t BITS>
+std::string to_string(const bigint<BITS, T>& v) {
+    const auto digits = to_digits<RADIX>(v);
+    std::size_t length = digits.size();
+    while (length > 0 && digits[length - 1] == 0) {
+        --length;
+    }
+    if (length == 0) {
+        return std::string(1, static_cast<char>(compose_digit<RADIX>(static_cast<std::uint8_t>(0))));
+    }
+    return std::string(digits.rbegin() + static_cast<std::ptrdiff_t>(digits.size() - length), digits.rend());
+}
+
+namespace impl {
+
+/*
+ * narrow (The low limbs of a, for values known to fit in BITS)
+ */
+template<std::size_t BITS, typename T, std::size_t A_BITS>
+constexpr bigint<BITS, T> narrow(const bigint<A_BITS, T>& a) {
+    bigint<BITS, T> result = {};
+    for (std::size_t i = 0; i < result.count && i < a.count; ++i) {
+        result[i] = a[i];
+    }
+    return result;
+}
+
+/*
+ * power_in_place (base^exponent for results known to fit in BITS, left-to-right binary)
+ */
+template<std::size_t BITS, typename T, std::size_t BASE_BITS>
+constexpr bigint<BITS, T> power_in_place(const bigint<BASE_BITS, T>& base, std::size_t exponent) {
+    bigint<BITS, T> result = { one<T>::value };
+    std::size_t bit = std::numeric_limits<std::size_t>::digits;
+    while (bit > 0 && ((exponent >> (bit - 1)) & 1u) == 0) {
+        --bit;
+    }
+    for (; bit > 0; --bit) {
+        result *= result;
+        if (((exponent >> (bit - 1)) & 1u) != 0) {
+            result *= base;
+        }
+    }
+    return result;
+}
+
+/*
+ * floor_logarithm (floor(log_base(value)) for base above one and non-zero value)
+ *
+ * The ratio of the fixed-point logarithms is within one of the answer,
+ * so starting one below it, base^k never overflows and at most a couple
+ * of multiplications by base finish the job.
  */
 template<typename T, std::size_t BASE_BITS, std::size_t VALUE_BITS>
-constexpr bigint<VALUE_BITS, T> logarithm(bigint<BASE_BITS, T> base, bigint<VALUE_BITS, T> value) {
-    if (is_equal(value, one<bigint<VALUE_BITS, T>>::value)) {
-        return zero<bigint<VALUE_BITS, T>>::value;
+constexpr std::size_t floor_logarithm(const bigint<BASE_BITS, T>& base, std::uint64_t log2_base, const bigint<VALUE_BITS, T>& value) {
+    const std::size_t estimate = static_cast<std::size_t>(log2_fixed(value.data(), value.count) / log2_base);
+    std::size_t k = estimate > 0 ? estimate - 1 : 0;
+    bigint<VALUE_BITS, T> power = power_in_place<VALUE_BITS>(base, k);
+    while (true) {
+        const auto next = multiply(power, base);
+        if (next > value) {
+            return k;
+        }
+        power = narrow<VALUE_BITS>(next);
+        ++k;
+    }
+}
+
+} //namespace impl
+
+/*
+ * logarithm (floor(log_base(value)), zero when value is zero or base is below two)
+ */
+template<typename T, std::size_t BASE_BITS, std::size_t VALUE_BITS>
+constexpr bigint<VALUE_BITS, T> logarithm(const bigint<BASE_BITS, T>& base, const bigint<VALUE_BITS, T>& value) {
+    bigint<VALUE_BITS, T> result = {};
+    const std::size_t base_bits = base.highest_bit();
+    const std::size_t value_bits = value.highest_bit();
+    if (base_bits < 2 || value_bits == 0) {
+        return result;
+    }
+    // Powers of two divide the bit length exactly
+    const std::size_t k = base.popcount() == 1
+        ? (value_bits - 1) / (base_bits - 1)
+        : impl::floor_logarithm(base, impl::log2_fixed(base.data(), base.count), value);
+    impl::from_word(result.data(), result.count, k);
+    return result;
+}
+
+/*
+ * log2 (floor(log2(value)), zero for zero)
+ */
+template<typename T, std::size_t BITS>
+constexpr std::size_t log2(const bigint<BITS, T>& value) {
+    const std::size_t bits = value.highest_bit();
+    return bits == 0 ? 0 : bits - 1;
+}
+
+/*
+ * log10 (floor(log10(value)), zero for zero)
+ */
+template<typename T, std::size_t BITS>
+constexpr std::size_t log10(const bigint<BITS, T>& value) {
+    constexpr std::uint64_t LOG2_TEN = impl::log2_fixed(&ten<T>::value, 1);
+    if (value.highest_bit() == 0) {
+        return 0;
+    }
+    return impl::floor_logarithm(ten<bigint<std::numeric_limits<T>::digits, T>>::value, LOG2_TEN, value);
+}
+
+/*
+ * integer_sqrt (floor(sqrt(value)), by Newton's iteration)
+ *
+ * x starts at 2^ceil(bits / 2), at or above the root, and decreases to it.
+ */
+template<typename T, std::size_t BITS>
+constexpr bigint<(BITS + 1) / 2, T> integer_sqrt(const bigint<BITS, T>& value) {
+    const std::size_t bits = value.highest_bit();
+    if (bits == 0) {
+        return {};
+    }
+    bigint<BITS, T> x = {};
+    x.set_bit((bits + 1) / 2);
+    while (true) {
+        const auto y = shift_right<1>(add(x, divide(value, x)));
+        if (x <= y) {
+            return impl::narrow<(BITS + 1) / 2>(x);
+        }
+        x = impl::narrow<BITS>(y);
+    }
+}
+
+/*
+ * nth_root (floor(value^(1 / n)) for n >= 1, by Newton's iteration)
+ */
+template<typename T, std::size_t BITS>
+constexpr bigint<BITS, T> nth_root(const bigint<BITS, T>& value, std::size_t n) {
+    typedef bigint<std::numeric_limits<std::size_t>::digits, T> word_type;
+    const std::size_t bits = value.highest_bit();
+    if (n <= 1 || bits == 0) {
+        return value;
+    }
+    if (n == 2) {
+        return of<T, (BITS + 1) / 2, BITS>(integer_sqrt(value));
     }
-    bigint<VALUE_BITS, T> exponent = zero<bigint<VALUE_BITS, T>>::value;
-    for (
-        bigint<VALUE_BITS + BASE_BITS, T> result = of<T, BASE_BITS, VALUE_BITS + BASE_BITS>(base);
-        result <= value;
-        result = multiply_in_place(result, base)
-    ) {
-        exponent = add_in_place(exponent, one<bigint<VALUE_BITS, T>>::value);
+    word_type n_word = {};
+    word_type n_less_one = {};
+    impl::from_word(n_word.data(), n_word.count, n);
+    impl::from_word(n_less_one.data(), n_less_one.count, n - 1);
+
+    bigint<BITS, T> x = {};
+    x.set_bit((bits + n - 1) / n);
+    while (true) {
+        // value / x^(n - 1), stopping early once the power passes value and the quotient is zero
+        bigint<BITS, T> power = { one<T>::value };
+        bool above = false;
+        for (std::size_t i = 1; i < n && !above; ++i) {
+            const auto next = multiply(power, x);
+            above = next > value;
+            power = impl::narrow<BITS>(next);
+        }
+        const bigint<BITS, T> quotient = above ? bigint<BITS, T>{} : divide(value, power);
+        const auto y = divide(add(multiply(x, n_less_one), quotient), n_word);
+        if (x <= y) {
+            return x;
+        }
+        x = impl::narrow<BITS>(y);
     }
-    return exponent;
 }
 
 /*
@@ -410,7 +2439,7 @@ constexpr bigint<VALUE_BITS, T> logarithm(bigint<BASE_BITS, T> base, bigint<VALU
  */
 template<char... DIGITS>
 constexpr auto operator "" _2() {
-    return from_digits<std::uint32_t, 8>(parse_digits_base8<DIGITS...>());
+    return from_digits<std::uint32_t, 2>(parse_digits_base2<DIGITS...>());
 }
 
 /*
@@ -447,6 +2476,25 @@ constexpr auto operator "" _64() {
 
 } //namespace numbers
 
+namespace std {
+
+/*
+ * hash (Multiply-xorshift over the limbs, for bigint keys in unordered containers)
+ */
+template<std::size_t BITS, typename T>
+struct hash<::numbers::bigint<BITS, T>> {
+    std::size_t operator()(const ::numbers::bigint<BITS, T>& value) const noexcept {
+        std::uint64_t h = 0;
+        for (std::size_t i = 0; i < value.count; ++i) {
+            h = (h ^ static_cast<std::uint64_t>(value[i])) * 0x9E3779B97F4A7C15u;
+            h ^= h >> 29;
+        }
+        return static_cast<std::size_t>(h ^ (h >> 32));
+    }
+};
+
+} //namespace std
+
 /*
  * bigint
  */
@@ -460,6 +2508,12 @@ static_assert(numbers::bigint<64, std::uint8_t>({ 255 }).highest_bit() == 8);
 static_assert(numbers::bigint<64, std::uint8_t>({ 255, 127 }).highest_bit() == 15);
 static_assert(numbers::bigint<64, std::uint8_t>({ 255, 255, 255, 1 }).highest_bit() == 25);
 static_assert(numbers::bigint<64, std::uint8_t>({ 255, 255, 255, 255, 255, 255, 255, 63 }).highest_bit() == 62);
+static_assert(numbers::bigint<128, std::uint64_t>({ 0, 0x8000000000000000 }).highest_bit() == 128);
+static_assert(numbers::bigint<128, std::uint64_t>({ 0x100000000, 0 }).highest_bit() == 33);
+static_assert(numbers::bigint<48, std::uint16_t>({ 0, 0x0100, 0 }).highest_bit() == 25);
+static_assert(numbers::bigint<64, std::uint8_t>({ 255, 255, 0, 0, 0, 0, 0, 0 }).highest_bit(2) == 16);
+static_assert(numbers::bigint<64, std::uint8_t>({ 255, 255, 0, 0, 0, 0, 0, 0 }).used_limbs() == 2);
+static_assert(numbers::bigint<64, std::uint8_t>({}).used_limbs() == 0);
 static_assert(numbers::bigint<8, std::uint8_t>({})[0] == static_cast<std::uint8_t>(0));
 static_assert(numbers::bigint<8, std::uint8_t>({}).size() == 1);
 static_assert(numbers::bigint<32, std::uint8_t>({}).size() == 4);
@@ -484,6 +2538,9 @@ static_assert(numbers::add<std::uint8_t, 8, 16>({255}, {0, 255})[1] == 255);
 static_assert(numbers::add<std::uint8_t, 8, 16>({255}, {0, 255})[2] == 0);
 static_assert(numbers::add<std::uint8_t, 8, 16>({1}, {1}).size() == 3);
 static_assert(numbers::add<std::uint8_t, 8, 16>({255}, {0, 255}).highest_bit() == 16);
+static_assert(numbers::add<std::uint8_t, 12, 12>({255, 7}, {1, 8}).size() == 2);
+static_assert(numbers::add<std::uint8_t, 12, 12>({255, 7}, {1, 8})[0] == 0);
+static_assert(numbers::add<std::uint8_t, 12, 12>({255, 7}, {1, 8})[1] == 16);
 
 /*
  * multiply
@@ -501,10 +2558,235 @@ static_assert(numbers::multiply<std::uint8_t, 16, 24>({123, 238}, {141, 25, 1})[
 static_assert(numbers::multiply<std::uint8_t, 16, 24>({123, 238}, {141, 25, 1})[3] == 6);
 static_assert(numbers::multiply<std::uint8_t, 16, 24>({123, 238}, {141, 25, 1})[4] == 1);
 static_assert(numbers::multiply<std::uint8_t, 16, 24>({123, 238}, {141, 25, 1}).size() == 5);
+static_assert(numbers::multiply<std::uint64_t, 64, 64>({0xFFFFFFFFFFFFFFFF}, {0xFFFFFFFFFFFFFFFF})[0] == 1);
+static_assert(numbers::multiply<std::uint64_t, 64, 64>({0xFFFFFFFFFFFFFFFF}, {0xFFFFFFFFFFFFFFFF})[1] == 0xFFFFFFFFFFFFFFFE);
+static_assert(numbers::multiply<std::uint64_t, 128, 64>({0x0123456789ABCDEF, 0xFEDCBA9876543210}, {0x1000000000000000})[0] == 0xF000000000000000);
+static_assert(numbers::multiply<std::uint64_t, 128, 64>({0x0123456789ABCDEF, 0xFEDCBA9876543210}, {0x1000000000000000})[1] == 0x00123456789ABCDE);
+static_assert(numbers::multiply<std::uint64_t, 128, 64>({0x0123456789ABCDEF, 0xFEDCBA9876543210}, {0x1000000000000000})[2] == 0x0FEDCBA987654321);
+static_assert(numbers::multiply_in_place<std::uint64_t, 128, 64>({0xFFFFFFFFFFFFFFFF}, {0xFFFFFFFFFFFFFFFF})[1] == 0xFFFFFFFFFFFFFFFE);
 
-namespace numbers {
+/*
+ * multiply (Karatsuba and Toom-3, checked against schoolbook by forcing the thresholds)
+ */
+static_assert(numbers::multiply<std::uint8_t, 64, 64, 2, 1000>(
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF})
+    == numbers::multiply<std::uint8_t, 64, 64, 1000, 1000>(
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}));
+static_assert(numbers::multiply<std::uint8_t, 56, 56, 2, 1000>(
+    {0x12, 0xFE, 0x00, 0x9A, 0xFF, 0x01, 0x80}, {0xFF, 0x00, 0xFF, 0x3C, 0x00, 0xC4, 0xFF})
+    == numbers::multiply<std::uint8_t, 56, 56, 1000, 1000>(
+    {0x12, 0xFE, 0x00, 0x9A, 0xFF, 0x01, 0x80}, {0xFF, 0x00, 0xFF, 0x3C, 0x00, 0xC4, 0xFF}));
+static_assert(numbers::multiply<std::uint8_t, 80, 80, 2, 5>(
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF})
+    == numbers::multiply<std::uint8_t, 80, 80, 1000, 1000>(
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}));
+static_assert(numbers::multiply<std::uint8_t, 88, 88, 3, 5>(
+    {0x01, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x77, 0x00, 0xFF, 0xFF, 0x10}, {0xFF, 0x00, 0x00, 0xFF, 0x02, 0x00, 0xFF, 0xFF, 0x00, 0xAB, 0xFF})
+    == numbers::multiply<std::uint8_t, 88, 88, 1000, 1000>(
+    {0x01, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x77, 0x00, 0xFF, 0xFF, 0x10}, {0xFF, 0x00, 0x00, 0xFF, 0x02, 0x00, 0xFF, 0xFF, 0x00, 0xAB, 0xFF}));
+static_assert(numbers::multiply<std::uint8_t, 80, 24, 2, 5>(
+    {0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF}, {0xFF, 0x7F, 0xFF})
+    == numbers::multiply<std::uint8_t, 80, 24, 1000, 1000>(
+    {0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF}, {0xFF, 0x7F, 0xFF}));
+static_assert(numbers::multiply_in_place<std::uint8_t, 80, 80, 2, 5>(
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF})
+    == numbers::multiply_in_place<std::uint8_t, 80, 80, 1000, 1000>(
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}));
+static_assert(numbers::multiply<std::uint8_t, 80, 80, 4, 5>(
+    {0xFF, 0xFF, 0xFF, 0, 0, 0, 0, 0, 0, 0}, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF})
+    == numbers::multiply<std::uint8_t, 80, 80, 1000, 1000>(
+    {0xFF, 0xFF, 0xFF, 0, 0, 0, 0, 0, 0, 0}, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}));
+
+/*
+ * square
+ */
+static_assert(numbers::square<std::uint8_t, 16>({0xFF, 0xFF})[0] == 0x01);
+static_assert(numbers::square<std::uint8_t, 16>({0xFF, 0xFF})[1] == 0x00);
+static_assert(numbers::square<std::uint8_t, 16>({0xFF, 0xFF})[2] == 0xFE);
+static_assert(numbers::square<std::uint8_t, 16>({0xFF, 0xFF})[3] == 0xFF);
+static_assert(numbers::square<std::uint8_t, 24>({123, 238, 7}) == numbers::multiply<std::uint8_t, 24, 24>({123, 238, 7}, {123, 238, 7}));
+static_assert(numbers::square<std::uint8_t, 80, 2, 1000>(
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF})
+    == numbers::multiply<std::uint8_t, 80, 80, 1000, 1000>(
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}));
+static_assert(numbers::square<std::uint8_t, 88, 3, 5>(
+    {0x01, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x77, 0x00, 0xFF, 0xFF, 0x10})
+    == numbers::multiply<std::uint8_t, 88, 88, 1000, 1000>(
+    {0x01, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x77, 0x00, 0xFF, 0xFF, 0x10}, {0x01, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x77, 0x00, 0xFF, 0xFF, 0x10}));
+static_assert(numbers::square<std::uint64_t, 128>({0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF})[0] == 1);
+static_assert(numbers::square<std::uint64_t, 128>({0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF})[2] == 0xFFFFFFFFFFFFFFFE);
+static_assert(numbers::square<std::uint64_t, 128>({0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF})[3] == 0xFFFFFFFFFFFFFFFF);
+static_assert([] {
+    numbers::bigint<24, std::uint8_t> a = {123, 238, 7};
+    return a * a == numbers::multiply(a, a);
+}());
+
+/*
+ * multiply_high / multiply_add (Portable Fallback)
+ */
+static_assert(numbers::impl::multiply_high<std::uint64_t>(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF) == 0xFFFFFFFFFFFFFFFE);
+static_assert(numbers::impl::multiply_high<std::uint64_t>(0x0123456789ABCDEF, 0xFEDCBA9876543210) == 0x0121FA00AD77D742);
+static_assert(numbers::impl::multiply_high<std::uint32_t>(0xFFFFFFFF, 0x10) == 0xF);
+static_assert([] {
+    std::uint64_t carry = 0xFFFFFFFFFFFFFFFF;
+    std::uint64_t low = numbers::impl::multiply_add<std::uint64_t, void>(
+        0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, carry);
+    return low == 0xFFFFFFFFFFFFFFFF && carry == 0xFFFFFFFFFFFFFFFF;
+}());
+static_assert([] {
+    std::uint64_t carry = 7;
+    std::uint64_t low = numbers::impl::multiply_add<std::uint64_t, void>(
+        0x0123456789ABCDEF, 0xFEDCBA9876543210, 3, carry);
+    return low == 0x2236D88FE5618CF0 + 10 && carry == 0x0121FA00AD77D742;
+}());
+
+/*
+ * subtract
+ */
+static_assert(numbers::subtract<std::uint8_t, 8, 8>({2}, {1})[0] == 1);
+static_assert(numbers::subtract<std::uint8_t, 8, 8>({2}, {1}).size() == 1);
+static_assert(numbers::subtract<std::uint8_t, 16, 8>({0, 1}, {1})[0] == 255);
+static_assert(numbers::subtract<std::uint8_t, 16, 8>({0, 1}, {1})[1] == 0);
+static_assert(numbers::subtract<std::uint8_t, 8, 16>({0}, {1})[0] == 255);
+static_assert(numbers::subtract<std::uint8_t, 8, 16>({0}, {1})[1] == 255);
+
+/*
+ * shift_left / shift_right
+ */
+static_assert(numbers::shift_left<4, std::uint8_t, 12>({0x21, 0x0F}).bits == 16);
+static_assert(numbers::shift_left<4, std::uint8_t, 12>({0x21, 0x0F})[0] == 0x10);
+static_assert(numbers::shift_left<4, std::uint8_t, 12>({0x21, 0x0F})[1] == 0xF2);
+static_assert(numbers::shift_left<12, std::uint8_t, 12>({0x21, 0x0F}).size() == 3);
+static_assert(numbers::shift_left<12, std::uint8_t, 12>({0x21, 0x0F})[1] == 0x10);
+static_assert(numbers::shift_left<12, std::uint8_t, 12>({0x21, 0x0F})[2] == 0xF2);
+static_assert(numbers::shift_right<4, std::uint8_t, 12>({0x21, 0x0F}).size() == 1);
+static_assert(numbers::shift_right<4, std::uint8_t, 12>({0x21, 0x0F})[0] == 0xF2);
+static_assert(numbers::shift_right<12, std::uint8_t, 12>({0x21, 0x0F}).bits == 1);
+static_assert((numbers::bigint<12, std::uint8_t>{0x21, 0x0F} << 4)[1] == 0x02);
+static_assert((numbers::bigint<12, std::uint8_t>{0x21, 0x0F} >> 9)[0] == 0x07);
+
+/*
+ * '~' and bit queries
+ */
+static_assert((~numbers::bigint<12, std::uint8_t>{0x21, 0x0F})[0] == 0xDE);
+static_assert((~numbers::bigint<12, std::uint8_t>{0x21, 0x0F})[1] == 0x00);
+static_assert((~numbers::bigint<12, std::uint8_t>{}).highest_bit() == 12);
+static_assert(numbers::bigint<24, std::uint8_t>{}.lowest_bit() == 0);
+static_assert(numbers::bigint<24, std::uint8_t>{0, 0, 0x80}.lowest_bit() == 24);
+static_assert(numbers::bigint<24, std::uint8_t>{0, 0x06, 0x80}.lowest_bit() == 10);
+static_assert(numbers::bigint<24, std::uint8_t>{0xFF, 0x06, 0x80}.popcount() == 11);
+static_assert(numbers::bigint<24, std::uint8_t>{0, 0x06, 0x80}.test_bit(9));
+static_assert(!numbers::bigint<24, std::uint8_t>{0, 0x06, 0x80}.test_bit(8));
+static_assert([] {
+    numbers::bigint<128, std::uint64_t> a = {};
+    a.set_bit(0);
+    a.set_bit(127);
+    a.set_bit(64);
+    a.clear_bit(0);
+    return a[0] == 0 && a[1] == 0x8000000000000001 && a.lowest_bit() == 65 && a.popcount() == 2 && a.test_bit(127);
+}());
+
+/*
+ * '+=', '-=', '*=', '++', '--' and multiply_accumulate
+ */
+static_assert([] {
+    numbers::bigint<32, std::uint8_t> a = {0xFF, 0xFF, 0x00, 0x01};
+    a += numbers::bigint<8, std::uint8_t>{1};
+    return a == numbers::bigint<32, std::uint8_t>{0x00, 0x00, 0x01, 0x01};
+}());
+static_assert([] {
+    numbers::bigint<16, std::uint8_t> a = {0xFF, 0xFF};
+    a += numbers::bigint<24, std::uint8_t>{1, 0, 7};
+    return a == std::uint8_t{0};
+}());
+static_assert([] {
+    numbers::bigint<32, std::uint8_t> a = {0x00, 0x00, 0x01, 0x01};
+    a -= numbers::bigint<8, std::uint8_t>{1};
+    a -= std::uint8_t{0xFF};
+    return a == numbers::bigint<32, std::uint8_t>{0x00, 0xFF, 0x00, 0x01};
+}());
+static_assert([] {
+    numbers::bigint<32, std::uint8_t> a = {0x12, 0x34, 0x56, 0x00};
+    a *= numbers::bigint<16, std::uint8_t>{0x00, 0x01};
+    a *= std::uint8_t{2};
+    return a == numbers::bigint<32, std::uint8_t>{0x00, 0x24, 0x68, 0xAC};
+}());
+static_assert([] {
+    numbers::bigint<32, std::uint8_t> a = {0x03, 0x01};
+    a *= a;
+    return a == numbers::bigint<32, std::uint8_t>{0x09, 0x06, 0x01};
+}());
+static_assert([] {
+    numbers::bigint<32, std::uint8_t> a = {0xFF, 0xFF, 0xFF, 0xFF};
+    const auto previous = a++;
+    ++a;
+    return a == std::uint8_t{1} && previous == numbers::bigint<32, std::uint8_t>{0xFF, 0xFF, 0xFF, 0xFF} && (--a) == std::uint8_t{0};
+}());
+static_assert([] {
+    numbers::bigint<32, std::uint8_t> acc = {0x01};
+    numbers::multiply_accumulate(acc, numbers::bigint<16, std::uint8_t>{0xFF, 0xFF}, numbers::bigint<16, std::uint8_t>{0xFF, 0xFF});
+    numbers::multiply_accumulate(acc, acc, numbers::bigint<8, std::uint8_t>{2});
+    return acc == numbers::bigint<32, std::uint8_t>{0x06, 0x00, 0xFA, 0xFF};
+}());
+
+/*
+ * compare and relational operators
+ */
+static_assert(numbers::compare(numbers::bigint<24, std::uint8_t>{1, 2, 3}, numbers::bigint<24, std::uint8_t>{1, 2, 3}) == 0);
+static_assert(numbers::compare(numbers::bigint<24, std::uint8_t>{2, 2, 3}, numbers::bigint<24, std::uint8_t>{1, 2, 3}) > 0);
+static_assert(numbers::compare(numbers::bigint<24, std::uint8_t>{9, 2, 2}, numbers::bigint<24, std::uint8_t>{1, 2, 3}) < 0);
+static_assert(numbers::compare(numbers::bigint<8, std::uint8_t>{9}, numbers::bigint<24, std::uint8_t>{1, 0, 1}) < 0);
+static_assert(numbers::compare(numbers::bigint<24, std::uint8_t>{1, 0, 1}, numbers::bigint<8, std::uint8_t>{9}) > 0);
+static_assert(numbers::compare(numbers::bigint<24, std::uint8_t>{9, 0, 0}, numbers::bigint<8, std::uint8_t>{9}) == 0);
+static_assert(numbers::bigint<16, std::uint8_t>{1, 2} < numbers::bigint<16, std::uint8_t>{2, 2});
+static_assert(!(numbers::bigint<16, std::uint8_t>{2, 2} < numbers::bigint<16, std::uint8_t>{2, 2}));
+static_assert(numbers::bigint<16, std::uint8_t>{2, 2} <= numbers::bigint<16, std::uint8_t>{2, 2});
+static_assert(numbers::bigint<16, std::uint8_t>{0, 3} > numbers::bigint<16, std::uint8_t>{255, 2});
+static_assert(numbers::bigint<16, std::uint8_t>{0, 3} >= numbers::bigint<8, std::uint8_t>{255});
+static_assert(numbers::bigint<16, std::uint8_t>{0, 3} != numbers::bigint<16, std::uint8_t>{0, 2});
+static_assert(numbers::bigint<16, std::uint8_t>{7, 0} == std::uint8_t{7});
+static_assert(numbers::bigint<16, std::uint8_t>{7, 1} != std::uint8_t{7});
+static_assert([] {
+    numbers::bigint<1024, std::uint64_t> a = {};
+    numbers::bigint<1024, std::uint64_t> b = {};
+    for (std::size_t i = 0; i < a.count; ++i) {
+        a[i] = b[i] = 0x0123456789ABCDEF * (i + 1);
+    }
+    b[3] += 1;
+    return a < b && b > a && a != b && numbers::compare(a, a) == 0;
+}());
+
+/*
+ * divmod
+ */
+static_assert(numbers::divmod<std::uint8_t, 16, 8>({0x34, 0x12}, {0x10}).quotient[0] == 0x23);
+static_assert(numbers::divmod<std::uint8_t, 16, 8>({0x34, 0x12}, {0x10}).quotient[1] == 0x01);
+static_assert(numbers::divmod<std::uint8_t, 16, 8>({0x34, 0x12}, {0x10}).remainder[0] == 0x04);
+static_assert(numbers::divmod<std::uint8_t, 16, 16>({0x34, 0x12}, {0x00, 0x20}).quotient[0] == 0);
+static_assert(numbers::divmod<std::uint8_t, 16, 16>({0x34, 0x12}, {0x00, 0x20}).remainder[0] == 0x34);
+static_assert(numbers::divmod<std::uint8_t, 16, 16>({0x34, 0x12}, {0x00, 0x20}).remainder[1] == 0x12);
+static_assert(numbers::divmod<std::uint8_t, 32, 16>({0xFF, 0xFF, 0xFF, 0xFF}, {0x01, 0x80}).quotient[0] == 0xFC);
+static_assert(numbers::divmod<std::uint8_t, 32, 16>({0xFF, 0xFF, 0xFF, 0xFF}, {0x01, 0x80}).quotient[1] == 0xFF);
+static_assert(numbers::divmod<std::uint8_t, 32, 16>({0xFF, 0xFF, 0xFF, 0xFF}, {0x01, 0x80}).quotient[2] == 0x01);
+static_assert(numbers::divmod<std::uint8_t, 32, 16>({0xFF, 0xFF, 0xFF, 0xFF}, {0x01, 0x80}).remainder[0] == 0x03);
+static_assert(numbers::divmod<std::uint8_t, 32, 16>({0xFF, 0xFF, 0xFF, 0xFF}, {0x01, 0x80}).remainder[1] == 0x00);
+
+/*
+ * divide_wide (Portable Fallback)
+ */
+static_assert([] {
+    std::uint64_t remainder = 0;
+    std::uint64_t quotient = numbers::impl::divide_wide<std::uint64_t, void>(
+        0x0000000000000001, 0x0000000000000000, 0x0000000000000003, remainder);
+    return quotient == 0x5555555555555555 && remainder == 1;
+}());
+static_assert([] {
+    std::uint64_t remainder = 0;
+    std::uint64_t quotient = numbers::impl::divide_wide<std::uint64_t, void>(
+        0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, remainder);
+    return quotient == 0xFFFFFFFFFFFFFFFF && remainder == 0xFFFFFFFFFFFFFFFE;
+}());
 
-}
 
 /*
  * zero
@@ -583,6 +2865,135 @@ static_assert(numbers::from_digits<std::uint32_t, 16>(numbers::parse_digits<16>(
 static_assert(numbers::from_digits<std::uint32_t, 16>(numbers::parse_digits<16>("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"))[2] == 0xFFFFFFFF);
 static_assert(numbers::from_digits<std::uint32_t, 16>(numbers::parse_digits<16>("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"))[3] == 0xFFFFFFFF);
 static_assert(numbers::from_digits<std::uint32_t, 16>(numbers::parse_digits<16>("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF")).size() == 4);
+static_assert(numbers::from_digits<std::uint64_t, 16>(numbers::parse_digits<16>("123456789ABCDEF0FEDCBA9876543210"))[0] == 0xFEDCBA9876543210);
+static_assert(numbers::from_digits<std::uint64_t, 16>(numbers::parse_digits<16>("123456789ABCDEF0FEDCBA9876543210"))[1] == 0x123456789ABCDEF0);
+static_assert(numbers::from_digits<std::uint8_t, 8>(numbers::parse_digits<8>("147625"))[0] == 0x95);
+static_assert(numbers::from_digits<std::uint8_t, 8>(numbers::parse_digits<8>("147625"))[1] == 0xCF);
+static_assert(numbers::from_digits<std::uint8_t, 8>(numbers::parse_digits<8>("147625"))[2] == 0x00);
+static_assert(numbers::from_digits<std::uint8_t, 8>(numbers::parse_digits<8>("147625")).size() == 3);
+static_assert(numbers::from_digits<std::uint32_t, 8>(numbers::parse_digits<8>("7777777777777"))[0] == 0xFFFFFFFF);
+static_assert(numbers::from_digits<std::uint32_t, 8>(numbers::parse_digits<8>("7777777777777"))[1] == 0x7F);
+static_assert(numbers::from_digits<std::uint32_t, 64>(numbers::parse_digits<64>("y5I"))[0] == 208456);
+static_assert(numbers::from_digits<std::uint8_t, 64>(numbers::parse_digits<64>("y5I"))[0] == 0x48);
+static_assert(numbers::from_digits<std::uint8_t, 64>(numbers::parse_digits<64>("y5I"))[1] == 0x2E);
+static_assert(numbers::from_digits<std::uint8_t, 64>(numbers::parse_digits<64>("y5I"))[2] == 0x03);
+static_assert(numbers::from_digits<std::uint8_t, 2>(numbers::parse_digits<2>("1000000001"))[0] == 0x01);
+static_assert(numbers::from_digits<std::uint8_t, 2>(numbers::parse_digits<2>("1000000001"))[1] == 0x02);
+static_assert([] {
+    // 10^600 + 7, long enough to be parsed by splitting at 10^576
+    std::array<std::uint8_t, 601> digits = { 1 };
+    digits[600] = 7;
+    numbers::bigint<2048, std::uint32_t> expected = { 1 };
+    for (std::size_t i = 0; i < 600; ++i) {
+        expected = numbers::multiply_in_place(expected, numbers::bigint<32, std::uint32_t>{ 10 });
+    }
+    expected = numbers::add_in_place(expected, numbers::bigint<32, std::uint32_t>{ 7 });
+    return numbers::from_digits<std::uint32_t>(digits) == expected;
+}());
+static_assert(numbers::from_digits<std::uint64_t>(numbers::parse_digits("340282366920938463463374607431768211455"))[0] == 0xFFFFFFFFFFFFFFFF);
+static_assert(numbers::from_digits<std::uint64_t>(numbers::parse_digits("340282366920938463463374607431768211455"))[1] == 0xFFFFFFFFFFFFFFFF);
+static_assert(numbers::from_digits<std::uint64_t>(numbers::parse_digits("340282366920938463463374607431768211455"))[2] == 0);
+static_assert(numbers::from_digits<std::uint64_t>(numbers::parse_digits("340282366920938463463374607431768211455")).size() == 3);
+
+/*
+ * to_digits
+ */
+
+// Base 10
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 }).size() == 20);
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[0] == '0');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[1] == '9');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[2] == '8');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[3] == '7');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[4] == '6');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[5] == '5');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[6] == '4');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[7] == '3');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[8] == '2');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[9] == '1');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint8_t>{ 0xD2, 0x02, 0x96, 0x49 })[10] == 0);
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint64_t>{ 10000000000000000000ULL })[0] == '0');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint64_t>{ 10000000000000000000ULL })[18] == '0');
+static_assert(numbers::to_digits(numbers::bigint<64, std::uint64_t>{ 10000000000000000000ULL })[19] == '1');
+
+// Base 10 (Divide-and-Conquer)
+static_assert([] {
+    numbers::bigint<2048, std::uint32_t> value = { 1 };
+    for (std::size_t i = 0; i < 600; ++i) {
+        value = numbers::multiply_in_place(value, numbers::bigint<32, std::uint32_t>{ 10 });
+    }
+    const auto digits = numbers::to_digits(value);
+    for (std::size_t i = 0; i < 600; ++i) {
+        if (digits[i] != '0') {
+            return false;
+        }
+    }
+    return digits[600] == '1' && digits[601] == 0;
+}());
+
+// Base 16
+static_assert(numbers::to_digits<16>(numbers::bigint<24, std::uint8_t>{ 0x56, 0xED, 0x0F })[0] == '6');
+static_assert(numbers::to_digits<16>(numbers::bigint<24, std::uint8_t>{ 0x56, 0xED, 0x0F })[1] == '5');
+static_assert(numbers::to_digits<16>(numbers::bigint<24, std::uint8_t>{ 0x56, 0xED, 0x0F })[2] == 'D');
+static_assert(numbers::to_digits<16>(numbers::bigint<24, std::uint8_t>{ 0x56, 0xED, 0x0F })[3] == 'E');
+static_assert(numbers::to_digits<16>(numbers::bigint<24, std::uint8_t>{ 0x56, 0xED, 0x0F })[4] == 'F');
+static_assert(numbers::to_digits<16>(numbers::bigint<24, std::uint8_t>{ 0x56, 0xED, 0x0F })[5] == 0);
+
+// Base 8
+static_assert(numbers::to_digits<8>(numbers::bigint<24, std::uint8_t>{ 0x95, 0xCF })[0] == '5');
+static_assert(numbers::to_digits<8>(numbers::bigint<24, std::uint8_t>{ 0x95, 0xCF })[1] == '2');
+static_assert(numbers::to_digits<8>(numbers::bigint<24, std::uint8_t>{ 0x95, 0xCF })[2] == '6');
+static_assert(numbers::to_digits<8>(numbers::bigint<24, std::uint8_t>{ 0x95, 0xCF })[3] == '7');
+static_assert(numbers::to_digits<8>(numbers::bigint<24, std::uint8_t>{ 0x95, 0xCF })[4] == '4');
+static_assert(numbers::to_digits<8>(numbers::bigint<24, std::uint8_t>{ 0x95, 0xCF })[5] == '1');
+static_assert(numbers::to_digits<8>(numbers::bigint<24, std::uint8_t>{ 0x95, 0xCF })[6] == 0);
+
+// Base 64
+static_assert(numbers::to_digits<64>(numbers::bigint<24, std::uint8_t>{ 0x48, 0x2E, 0x03 })[0] == 'I');
+static_assert(numbers::to_digits<64>(numbers::bigint<24, std::uint8_t>{ 0x48, 0x2E, 0x03 })[1] == '5');
+static_assert(numbers::to_digits<64>(numbers::bigint<24, std::uint8_t>{ 0x48, 0x2E, 0x03 })[2] == 'y');
+static_assert(numbers::to_digits<64>(numbers::bigint<24, std::uint8_t>{ 0x48, 0x2E, 0x03 })[3] == 0);
+
+// Base 2
+static_assert(numbers::to_digits<2>(numbers::bigint<16, std::uint8_t>{ 0x00, 0x05 })[8] == '1');
+static_assert(numbers::to_digits<2>(numbers::bigint<16, std::uint8_t>{ 0x00, 0x05 })[9] == '0');
+static_assert(numbers::to_digits<2>(numbers::bigint<16, std::uint8_t>{ 0x00, 0x05 })[10] == '1');
+static_assert(numbers::to_digits<2>(numbers::bigint<16, std::uint8_t>{ 0x00, 0x05 })[11] == 0);
+
+/*
+ * parse
+ */
+static_assert(numbers::parse<64, std::uint32_t>("1234567890").error == std::errc{});
+static_assert(numbers::parse<64, std::uint32_t>("1234567890").value[0] == 1234567890);
+static_assert(numbers::parse<64, std::uint32_t>("18446744073709551615").value[0] == 0xFFFFFFFF);
+static_assert(numbers::parse<64, std::uint32_t>("18446744073709551615").value[1] == 0xFFFFFFFF);
+static_assert(numbers::parse<64, std::uint32_t>("18446744073709551616").error == std::errc::result_out_of_range);
+static_assert(numbers::parse<60, std::uint32_t>("1152921504606846975").error == std::errc{});
+static_assert(numbers::parse<60, std::uint32_t>("1152921504606846976").error == std::errc::result_out_of_range);
+static_assert(numbers::parse<64, std::uint32_t>("12345x7890").error == std::errc::invalid_argument);
+static_assert(numbers::parse<64, std::uint32_t>("12345x7890").position == 5);
+static_assert(numbers::parse<64, std::uint32_t>("12345x7890").value[0] == 0);
+static_assert(numbers::parse<64, std::uint32_t>("").error == std::errc::invalid_argument);
+static_assert(numbers::parse<64, std::uint32_t>("0000000000000000000000000000000042").value[0] == 42);
+static_assert(numbers::parse<128, std::uint64_t>("340282366920938463463374607431768211455").value[1] == 0xFFFFFFFFFFFFFFFF);
+static_assert(numbers::parse<128, std::uint64_t>("340282366920938463463374607431768211456").error == std::errc::result_out_of_range);
+static_assert(numbers::parse<64, std::uint32_t, 16>("FFFFFFFFfffffffe").value[0] == 0xFFFFFFFE);
+static_assert(numbers::parse<64, std::uint32_t, 16>("FFFFFFFFfffffffe").value[1] == 0xFFFFFFFF);
+static_assert(numbers::parse<64, std::uint32_t, 16>("000000000000000000001").value[0] == 1);
+static_assert(numbers::parse<64, std::uint32_t, 16>("10000000000000000").error == std::errc::result_out_of_range);
+static_assert(numbers::parse<62, std::uint32_t, 16>("3FFFFFFFFFFFFFFF").error == std::errc{});
+static_assert(numbers::parse<62, std::uint32_t, 16>("7FFFFFFFFFFFFFFF").error == std::errc::result_out_of_range);
+static_assert(numbers::parse<64, std::uint32_t, 16>("0xFF").error == std::errc::invalid_argument);
+static_assert(numbers::parse<64, std::uint32_t, 16>("0xFF").position == 1);
+static_assert(numbers::parse<64, std::uint32_t, 8>("147625").value[0] == 0147625);
+static_assert(numbers::parse<64, std::uint32_t, 8>("1476258").error == std::errc::invalid_argument);
+static_assert(numbers::parse<64, std::uint32_t, 2>("1011").value[0] == 11);
+static_assert(numbers::parse<64, std::uint32_t, 64>("y5I").value[0] == 208456);
+static_assert(numbers::parse<64, std::uint32_t, 64>("y5I=").error == std::errc::invalid_argument);
+static_assert(numbers::parse<512, std::uint32_t>("0000000000000000000000000000000000000000000000000000000000000000000000000000000123").value[0] == 123);
+static_assert(numbers::parse<512, std::uint32_t>("00000000000000000000000000000000000000000000000000000000000000000000000000000001x3").position == 80);
+static_assert(numbers::parse<512, std::uint32_t, 16>("0000000000000000000000000000000000000000000000000000000000000000000000000000000F").value[0] == 15);
+static_assert(numbers::parse<512, std::uint32_t, 16>("000000000000000000000000000000000000000000000000000000000000000000000000000000G1").position == 78);
 
 namespace numbers {
 
@@ -590,6 +3001,36 @@ namespace numbers {
  * logarithm
  */
 static_assert(numbers::logarithm(10_10, 115792089237316195423570985008687907853269984665640564039457584007913129639935_10) == 77_10, "Log10(115792089237316195423570985008687907853269984665640564039457584007913129639935)");
+static_assert(logarithm(31_10, 115792089237316195423570985008687907853269984665640564039457584007913129639935_10) == 51_10);
+static_assert(logarithm(16_10, 115792089237316195423570985008687907853269984665640564039457584007913129639935_10) == 63_10);
+static_assert(logarithm(10_10, 100000000000000000000000000000000000000000_10) == 41_10);
+static_assert(logarithm(10_10, 99999999999999999999999999999999999999999_10) == 40_10);
+static_assert(logarithm(10_10, 0_10) == 0_10);
+static_assert(logarithm(1_10, 1000_10) == 0_10);
+static_assert(logarithm(bigint<64>{10}, bigint<64>{1000}) == bigint<64>{3});
+
+/*
+ * log2 / log10
+ */
+static_assert(log2(115792089237316195423570985008687907853269984665640564039457584007913129639935_10) == 255);
+static_assert(log2(0x1_16) == 0);
+static_assert(log10(115792089237316195423570985008687907853269984665640564039457584007913129639935_10) == 77);
+static_assert(log10(10000000000000000000000000000000000000000_10) == 40);
+static_assert(log10(9999999999999999999999999999999999999999_10) == 39);
+static_assert(log10(9_10) == 0);
+
+/*
+ * integer_sqrt / nth_root
+ */
+static_assert(integer_sqrt(115792089237316195423570985008687907853269984665640564039457584007913129639935_10) == 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_16);
+static_assert(integer_sqrt(115792089237316195423570985008687907853269984665640564039457584007913129639935_10).bits == 130);
+static_assert(integer_sqrt(10000000000000000000000000000000000000000_10) == 100000000000000000000_10);
+static_assert(integer_sqrt(9999999999999999999999999999999999999999_10) == 99999999999999999999_10);
+static_assert(nth_root(115792089237316195423570985008687907853269984665640564039457584007913129639935_10, 3) == 0x285145f31ae515c447bb56_16);
+static_assert(nth_root(115792089237316195423570985008687907853269984665640564039457584007913129639935_10, 5) == 0x93088c35d733a_16);
+static_assert(nth_root(115792089237316195423570985008687907853269984665640564039457584007913129639935_10, 300) == 1_10);
+static_assert(nth_root(1000000000000000000000000000000_10, 10) == 1000_10);
+static_assert(nth_root(999999999999999999999999999999_10, 10) == 999_10);
 
 /*
  * _10 (Base 10 User-Defined-Literal)
@@ -618,6 +3059,62 @@ static_assert((11579208923731619542357098500868790785326998466564056403945758400
 static_assert((115792089237316195423570985008687907853269984665640564039457584007913129639935_10).count == 9);
 static_assert((115792089237316195423570985008687907853269984665640564039457584007913129639935_10).highest_bit() == 256);
 
+/*
+ * '-', '/' and '%' (Subtraction, Division and Modulo Operators)
+ */
+static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_10 - 340282366920938463463374607431768211455_10
+              == 115792089237316195423570985008687907852929702298719625575994209400481361428480_10);
+static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_10 / 10_10
+              == 11579208923731619542357098500868790785326998466564056403945758400791312963993_10);
+static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_10 % 10_10 == 5_10);
+static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_10 / std::uint32_t{10}
+              == 11579208923731619542357098500868790785326998466564056403945758400791312963993_10);
+static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_10 % std::uint32_t{10} == 5_10);
+static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_10 / 340282366920938463463374607431768211455_10
+              == 340282366920938463463374607431768211457_10);
+static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_10 % 340282366920938463463374607431768211455_10 == 0_10);
+static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_10 / 123456789012345678901234567890123456789_10
+              == 937915931263504565146590403111252224066_10);
+static_assert(115792089237316195423570985008687907853269984665640564039457584007913129639935_10 % 123456789012345678901234567890123456789_10
+              == 115889015247728173068284357820832755861_10);
+static_assert(0x1234567890ABCDEF1234567890abcdef_16 / 0xFEDCBA987_16 == 0x124924923f7c3eb0a09395d_16);
+static_assert(0x1234567890ABCDEF1234567890abcdef_16 % 0xFEDCBA987_16 == 0x7993128e4_16);
+
+/*
+ * '<<', '>>', '&', '|', '^' and '~' (Shift and Bitwise Operators)
+ */
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 << identity<std::size_t, 68>{}).bits == 196);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 << identity<std::size_t, 68>{})
+              == 0x1234567890abcdef1234567890abcdef00000000000000000_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 >> identity<std::size_t, 68>{}).bits == 60);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 >> identity<std::size_t, 68>{}) == 0x1234567890abcde_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 >> identity<std::size_t, 200>{}) == 0x0_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 << 100) == 0xabcdef0000000000000000000000000_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 << 0) == 0x1234567890ABCDEF1234567890abcdef_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 >> 33) == 0x91a2b3c4855e6f7891a2b3c_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 >> 128) == 0x0_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 & 0xFEDCBA9876543210_16) == 0x1214121810000000_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 & 0xFEDCBA9876543210_16).bits == 64);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 | 0xFEDCBA987_16) == 0x1234567890abcdef1234567ffdebedef_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16 ^ 0xFEDCBA987_16) == 0x1234567890abcdef123456777d606468_16);
+static_assert(~0x1234567890ABCDEF1234567890abcdef_16 == 0xedcba9876f543210edcba9876f543210_16);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16).popcount() == 64);
+static_assert((0x1234567890ABCDEF1234567890abcdef_16).lowest_bit() == 1);
+static_assert((0x1234567890abcdef00000000000000000_16).lowest_bit() == 69);
+
+/*
+ * _2 (Base 2 User-Defined-Literal)
+ */
+static_assert(1011_2[0] == 11);
+static_assert((1011_2).bits == 4);
+static_assert(11111111111111111111111111111111111_2[0] == 0xFFFFFFFF);
+static_assert(11111111111111111111111111111111111_2[1] == 0x7);
+
+/*
+ * _8 (Base 8 User-Defined-Literal)
+ */
+static_assert(0147625_8[0] == 0147625);
+
 /*
  * _16 (Base 16 User-Defined-Literal)
  */
@@ -628,6 +3125,9 @@ static_assert(0x1234567890ABCDEF1234567890abcdef_16[1] == 0x12345678);
 static_assert(0x1234567890ABCDEF1234567890abcdef_16[2] == 0x90ABCDEF);
 static_assert(0x1234567890ABCDEF1234567890abcdef_16[3] == 0x12345678);
 static_assert((0x1234567890ABCDEF1234567890abcdef_16).size() == 4);
+static_assert(0xFEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210_16[15] == 0xFEDCBA98);
+static_assert(0xFEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210_16[0] == 0x76543210);
+static_assert((0xFEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210FEDCBA9876543210_16).highest_bit() == 512);
 
 } //namespace numbers
 
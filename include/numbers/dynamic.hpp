@@ -0,0 +1,890 @@
+#ifndef NUMBERS_DYNAMIC_HH
+#define NUMBERS_DYNAMIC_HH
+
+#include "bigint.hpp"
+#include "radix.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace numbers {
+namespace impl {
+
+/*
+ * dynamic_inline_limbs (Limbs a dynamic_bigint stores in the object before it allocates)
+ */
+template<typename T>
+struct dynamic_inline_limbs : identity<std::size_t, 4> {};
+
+/*
+ * limb_scratch (n limbs of temporary storage for a dynamic_bigint kernel, released at scope exit)
+ *
+ * Short buffers stay on the stack and longer ones come from the allocator
+ * of the operands. arena.hpp specializes this to hand out the arena's
+ * reusable scratch buffer instead.
+ */
+template<typename T, typename Allocator>
+class limb_scratch {
+public:
+    limb_scratch(const Allocator& source, std::size_t count) :
+        allocator(source),
+        n(count),
+        heap(count > local.size() ? std::allocator_traits<Allocator>::allocate(allocator, count) : nullptr)
+    {}
+
+    limb_scratch(const limb_scratch&) = delete;
+    limb_scratch& operator=(const limb_scratch&) = delete;
+
+    ~limb_scratch() {
+        if (heap != nullptr) {
+            std::allocator_traits<Allocator>::deallocate(allocator, heap, n);
+        }
+    }
+
+    T* data() noexcept {
+        return heap != nullptr ? heap : local.data();
+    }
+
+private:
+    Allocator allocator;
+    std::size_t n;
+    std::array<T, dynamic_inline_limbs<T>::value> local = {};
+    T* heap;
+};
+
+} //namespace impl
+
+/*
+ * dynamic_bigint (Runtime-sized unsigned integer, small values stored in place)
+ *
+ * Holds size() limbs, least significant first, with a non-zero top limb;
+ * zero has no limbs. Up to dynamic_inline_limbs<T> limbs live inside the
+ * object. Longer values move to a buffer from Allocator that grows
+ * geometrically and is kept until destruction, so a value that shrinks and
+ * grows again does not reallocate. Results take the allocator of one of
+ * their operands; assignment keeps the allocator of the target.
+ */
+template<
+    typename T = std::uint32_t,
+    typename Allocator = std::allocator<T>,
+    typename = std::enable_if_t<
+        std::is_integral<T>::value
+        && !std::is_signed<T>::value
+        && std::is_same<typename Allocator::value_type, T>::value
+    >
+>
+class dynamic_bigint : private Allocator {
+    typedef std::allocator_traits<Allocator> traits;
+
+public:
+    typedef Allocator allocator_type;
+
+    static constexpr std::size_t inline_count = impl::dynamic_inline_limbs<T>::value;
+
+    dynamic_bigint() = default;
+
+    explicit dynamic_bigint(const Allocator& alloc) noexcept :
+        Allocator(alloc)
+    {}
+
+    explicit dynamic_bigint(T value, const Allocator& alloc = Allocator()) noexcept :
+        Allocator(alloc)
+    {
+        local[0] = value;
+        length = value != zero<T>::value ? 1 : 0;
+    }
+
+    template<std::size_t BITS>
+    explicit dynamic_bigint(const bigint<BITS, T>& value, const Allocator& alloc = Allocator()) :
+        Allocator(alloc)
+    {
+        assign(value.data(), value.used_limbs());
+    }
+
+    dynamic_bigint(const dynamic_bigint& other) :
+        Allocator(traits::select_on_container_copy_construction(other.get_allocator()))
+    {
+        assign(other.data(), other.length);
+    }
+
+    dynamic_bigint(dynamic_bigint&& other) noexcept :
+        Allocator(std::move(other.get_allocator()))
+    {
+        take(other);
+    }
+
+    dynamic_bigint& operator=(const dynamic_bigint& other) {
+        if (this != &other) {
+            assign(other.data(), other.length);
+        }
+        return *this;
+    }
+
+    dynamic_bigint& operator=(dynamic_bigint&& other) {
+        if (this != &other) {
+            if (get_allocator() == other.get_allocator()) {
+                release();
+                take(other);
+            } else {
+                assign(other.data(), other.length);
+            }
+        }
+        return *this;
+    }
+
+    ~dynamic_bigint() {
+        release();
+    }
+
+    allocator_type get_allocator() const noexcept {
+        return static_cast<const Allocator&>(*this);
+    }
+
+    // The heap buffer is in use exactly when the capacity exceeds the inline limbs; testing
+    // the capacity lets the compiler see that data() after reserve(n) holds n limbs.
+    T* data() noexcept {
+        return allocated > inline_count ? heap : local.data();
+    }
+
+    const T* data() const noexcept {
+        return allocated > inline_count ? heap : local.data();
+    }
+
+    T& operator[](std::size_t i) noexcept {
+        return data()[i];
+    }
+
+    const T& operator[](std::size_t i) const noexcept {
+        return data()[i];
+    }
+
+    /*
+     * size (Limbs in use, zero for zero)
+     */
+    std::size_t size() const noexcept {
+        return length;
+    }
+
+    /*
+     * capacity (Limbs available before the next allocation)
+     */
+    std::size_t capacity() const noexcept {
+        return allocated;
+    }
+
+    /*
+     * reserve (Grows the buffer to at least n limbs, keeping the value)
+     */
+    void reserve(std::size_t n) {
+        if (n <= allocated) {
+            return;
+        }
+        const std::size_t grown = std::max(n, 2 * allocated);
+        Allocator& alloc = *this;
+        T* buffer = traits::allocate(alloc, grown);
+        std::copy(data(), data() + length, buffer);
+        release();
+        heap = buffer;
+        allocated = grown;
+    }
+
+    /*
+     * resize (n limbs, new ones zero; call normalize once the limbs are written)
+     */
+    void resize(std::size_t n) {
+        reserve(n);
+        if (n > length) {
+            std::fill(data() + length, data() + n, zero<T>::value);
+        }
+        length = n;
+    }
+
+    /*
+     * normalize (Drops zero limbs from the top, restoring the size invariant)
+     */
+    void normalize() noexcept {
+        length = impl::used_limbs(data(), length);
+    }
+
+    /*
+     * highest_bit (One-based position of the highest set bit, zero for zero)
+     */
+    std::size_t highest_bit() const noexcept {
+        if (length == 0) {
+            return 0;
+        }
+        return length * std::numeric_limits<T>::digits - impl::count_leading_zeros(data()[length - 1]);
+    }
+
+    /*
+     * lowest_bit (One-based position of the lowest set bit, zero for zero)
+     */
+    std::size_t lowest_bit() const noexcept {
+        for (std::size_t i = 0; i < length; ++i) {
+            if (data()[i] != zero<T>::value) {
+                return i * std::numeric_limits<T>::digits + impl::count_trailing_zeros(data()[i]) + 1;
+            }
+        }
+        return 0;
+    }
+
+    /*
+     * popcount (Number of set bits)
+     */
+    std::size_t popcount() const noexcept {
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < length; ++i) {
+            n += impl::count_ones(data()[i]);
+        }
+        return n;
+    }
+
+    /*
+     * test_bit, set_bit and clear_bit (Zero-based bit index; set_bit grows the value as needed)
+     */
+    bool test_bit(std::size_t bit) const noexcept {
+        constexpr std::size_t DIGITS = std::numeric_limits<T>::digits;
+        return bit / DIGITS < length && (data()[bit / DIGITS] >> (bit % DIGITS) & one<T>::value) != zero<T>::value;
+    }
+
+    void set_bit(std::size_t bit) {
+        constexpr std::size_t DIGITS = std::numeric_limits<T>::digits;
+        if (bit / DIGITS >= length) {
+            resize(bit / DIGITS + 1);
+        }
+        data()[bit / DIGITS] = static_cast<T>(data()[bit / DIGITS] | static_cast<T>(one<T>::value << (bit % DIGITS)));
+    }
+
+    void clear_bit(std::size_t bit) noexcept {
+        constexpr std::size_t DIGITS = std::numeric_limits<T>::digits;
+        if (bit / DIGITS < length) {
+            data()[bit / DIGITS] = static_cast<T>(data()[bit / DIGITS] & static_cast<T>(~(one<T>::value << (bit % DIGITS))));
+            normalize();
+        }
+    }
+
+private:
+    void release() noexcept {
+        if (heap != nullptr) {
+            Allocator& alloc = *this;
+            traits::deallocate(alloc, heap, allocated);
+            heap = nullptr;
+            allocated = inline_count;
+        }
+    }
+
+    void assign(const T* limbs, std::size_t n) {
+        reserve(n);
+        std::copy(limbs, limbs + n, data());
+        length = n;
+    }
+
+    void take(dynamic_bigint& other) noexcept {
+        heap = other.heap;
+        allocated = other.allocated;
+        length = other.length;
+        if (heap == nullptr) {
+            local = other.local;
+        }
+        other.heap = nullptr;
+        other.allocated = inline_count;
+        other.length = 0;
+    }
+
+    std::array<T, inline_count> local = {};
+    T* heap = nullptr;
+    std::size_t length = 0;
+    std::size_t allocated = inline_count;
+};
+
+/*
+ * to_dynamic (The value of a fixed-width bigint as a dynamic_bigint)
+ */
+template<typename T, std::size_t BITS, typename Allocator = std::allocator<T>>
+dynamic_bigint<T, Allocator> to_dynamic(const bigint<BITS, T>& a, const Allocator& allocator = Allocator()) {
+    return dynamic_bigint<T, Allocator>(a, allocator);
+}
+
+/*
+ * of (The low BITS bits of a dynamic_bigint as a fixed-width bigint)
+ */
+template<std::size_t BITS, typename T, typename Allocator>
+bigint<BITS, T> of(const dynamic_bigint<T, Allocator>& a) {
+    bigint<BITS, T> value = {  };
+    const std::size_t n = std::min(a.size(), value.count);
+    for (std::size_t i = 0; i < n; i++) {
+        value[i] = a[i];
+    }
+    value[value.count - 1] = static_cast<T>(value[value.count - 1] & impl::top_limb_mask<T, BITS>::value);
+    return value;
+}
+
+/*
+ * '+=' and '-=' (Compound Addition and Subtraction, b must not exceed a for '-=')
+ *
+ * The carry or borrow past the limbs of b stops as soon as it clears. b
+ * may be a itself.
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator+=(dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    const std::size_t m = b.size();
+    const std::size_t n = std::max(a.size(), m);
+    a.resize(n + 1);
+    T carry = impl::add_limbs(a.data(), a.data(), m, b.data(), m);
+    a[n] = impl::increment_limbs(a.data() + m, n - m, carry);
+    a.normalize();
+    return a;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator+=(dynamic_bigint<T, Allocator>& a, T b) {
+    const std::size_t n = a.size();
+    a.resize(n + 1);
+    a[n] = impl::increment_limbs(a.data(), n, b);
+    a.normalize();
+    return a;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator-=(dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    const std::size_t m = b.size();
+    a.resize(std::max(a.size(), m));
+    const T borrow = impl::subtract_limbs(a.data(), a.data(), m, b.data(), m);
+    impl::decrement_limbs(a.data() + m, a.size() - m, borrow);
+    a.normalize();
+    return a;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator-=(dynamic_bigint<T, Allocator>& a, T b) {
+    impl::decrement_limbs(a.data(), a.size(), b);
+    a.normalize();
+    return a;
+}
+
+/*
+ * add
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> add(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    const dynamic_bigint<T, Allocator>& longer = a.size() < b.size() ? b : a;
+    const dynamic_bigint<T, Allocator>& shorter = a.size() < b.size() ? a : b;
+    dynamic_bigint<T, Allocator> result(a.get_allocator());
+    result.resize(longer.size() + 1);
+    result[longer.size()] = impl::add_limbs(result.data(), longer.data(), longer.size(), shorter.data(), shorter.size());
+    result.normalize();
+    return result;
+}
+
+/*
+ * subtract (b must not exceed a)
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> subtract(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    dynamic_bigint<T, Allocator> result = a;
+    return result -= b;
+}
+
+/*
+ * multiply (Schoolbook over the used limbs, or the squaring kernel when b is a)
+ *
+ * Karatsuba and Toom-3 recurse on compile-time widths, so runtime-sized
+ * operands take the schoolbook kernels.
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> multiply(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    dynamic_bigint<T, Allocator> result(a.get_allocator());
+    if (a.size() == 0 || b.size() == 0) {
+        return result;
+    }
+    result.resize(a.size() + b.size());
+    if (&a == &b) {
+        impl::square_schoolbook(result.data(), a.data(), a.size());
+    } else {
+        impl::multiply_schoolbook(result.data(), a.data(), a.size(), b.data(), b.size());
+    }
+    result.normalize();
+    return result;
+}
+
+/*
+ * square
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> square(const dynamic_bigint<T, Allocator>& a) {
+    return multiply(a, a);
+}
+
+/*
+ * '*=' (Compound Multiplication, in the buffer of a)
+ *
+ * Rows run from the top limb of a down, so each limb of a is read before
+ * any row writes to it, and no allocation happens while the product fits
+ * the capacity of a. When b is a itself its limbs are copied to scratch
+ * first.
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator*=(dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    const std::size_t n = a.size();
+    const std::size_t m = b.size();
+    if (n == 0 || m == 0) {
+        a.resize(0);
+        return a;
+    }
+    impl::limb_scratch<T, Allocator> copy(a.get_allocator(), &a == &b ? m : 0);
+    const T* multiplier = b.data();
+    if (&a == &b) {
+        std::copy(b.data(), b.data() + m, copy.data());
+        multiplier = copy.data();
+    }
+    a.resize(n + m);
+    for (std::size_t i = n; i > 0; --i) {
+        const std::size_t row = i - 1;
+        const T limb = a[row];
+        a[row] = zero<T>::value;
+        const T carry = impl::multiply_add_row(a.data() + row, multiplier, m, limb);
+        impl::increment_limbs(a.data() + row + m, n - row, carry);
+    }
+    a.normalize();
+    return a;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator*=(dynamic_bigint<T, Allocator>& a, T b) {
+    const std::size_t n = a.size();
+    a.resize(n + 1);
+    T carry = zero<T>::value;
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = impl::multiply_add(a[i], b, zero<T>::value, carry);
+    }
+    a[n] = carry;
+    a.normalize();
+    return a;
+}
+
+/*
+ * multiply_accumulate (acc += b * c)
+ *
+ * Adds each row of the product straight into acc instead of forming b * c
+ * first. When acc is b or c, its limbs are copied to scratch first.
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& multiply_accumulate(dynamic_bigint<T, Allocator>& acc, const dynamic_bigint<T, Allocator>& b, const dynamic_bigint<T, Allocator>& c) {
+    const std::size_t n = b.size();
+    const std::size_t m = c.size();
+    if (n == 0 || m == 0) {
+        return acc;
+    }
+    const bool aliased = &acc == &b || &acc == &c;
+    impl::limb_scratch<T, Allocator> copy(acc.get_allocator(), aliased ? acc.size() : 0);
+    if (aliased) {
+        std::copy(acc.data(), acc.data() + acc.size(), copy.data());
+    }
+    const std::size_t size = std::max(acc.size(), n + m) + 1;
+    acc.resize(size);
+    const T* multiplicand = &acc == &b ? copy.data() : b.data();
+    const T* multiplier = &acc == &c ? copy.data() : c.data();
+    for (std::size_t j = 0; j < m; ++j) {
+        const T carry = impl::multiply_add_row(acc.data() + j, multiplicand, n, multiplier[j]);
+        impl::increment_limbs(acc.data() + j + n, size - j - n, carry);
+    }
+    acc.normalize();
+    return acc;
+}
+
+/*
+ * divmod (Quotient and remainder by Knuth's Algorithm D, b must be non-zero)
+ *
+ * The normalized dividend is built in the remainder, so the only other
+ * buffer is the normalized divisor, which lives in scratch.
+ */
+template<typename T, typename Allocator>
+divmod_result<dynamic_bigint<T, Allocator>, dynamic_bigint<T, Allocator>> divmod(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    divmod_result<dynamic_bigint<T, Allocator>, dynamic_bigint<T, Allocator>> result = {
+        dynamic_bigint<T, Allocator>(a.get_allocator()),
+        dynamic_bigint<T, Allocator>(a.get_allocator())
+    };
+    const std::size_t n = a.size();
+    const std::size_t m = b.size();
+    if (n < m) {
+        result.remainder = a;
+        return result;
+    }
+
+    if (m == 1) {
+        result.quotient.resize(n);
+        T remainder = zero<T>::value;
+        for (std::size_t i = n; i > 0; --i) {
+            result.quotient[i - 1] = impl::divide_wide(remainder, a[i - 1], b[0], remainder);
+        }
+        result.quotient.normalize();
+        result.remainder = dynamic_bigint<T, Allocator>(remainder, a.get_allocator());
+        return result;
+    }
+
+    const int s = impl::count_leading_zeros(b[m - 1]);
+    impl::limb_scratch<T, Allocator> vn(a.get_allocator(), m);
+    impl::shift_left_limbs(vn.data(), m, b.data(), m, s);
+    dynamic_bigint<T, Allocator>& un = result.remainder;
+    un.resize(n + 1);
+    impl::shift_left_limbs(un.data(), n + 1, a.data(), n, s);
+
+    result.quotient.resize(n - m + 1);
+    impl::divide_normalized(result.quotient.data(), un.data(), n, vn.data(), m);
+    result.quotient.normalize();
+    impl::shift_right_limbs(un.data(), m, un.data(), m + 1, s);
+    un.resize(m);
+    un.normalize();
+    return result;
+}
+
+/*
+ * divide
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> divide(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return divmod(a, b).quotient;
+}
+
+/*
+ * modulo
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> modulo(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return divmod(a, b).remainder;
+}
+
+/*
+ * '+', '-', '*', '/' and '%' (Arithmetic Operators)
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator+(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return add(a, b);
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator+(const dynamic_bigint<T, Allocator>& a, T b) {
+    dynamic_bigint<T, Allocator> result = a;
+    return result += b;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator-(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return subtract(a, b);
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator-(const dynamic_bigint<T, Allocator>& a, T b) {
+    dynamic_bigint<T, Allocator> result = a;
+    return result -= b;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator*(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return multiply(a, b);
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator*(const dynamic_bigint<T, Allocator>& a, T b) {
+    dynamic_bigint<T, Allocator> result = a;
+    return result *= b;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator/(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return divide(a, b);
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator/(const dynamic_bigint<T, Allocator>& a, T b) {
+    return divide(a, dynamic_bigint<T, Allocator>(b, a.get_allocator()));
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator%(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return modulo(a, b);
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator%(const dynamic_bigint<T, Allocator>& a, T b) {
+    return modulo(a, dynamic_bigint<T, Allocator>(b, a.get_allocator()));
+}
+
+/*
+ * '++' and '--' (Increment and Decrement Operators, '--' needs a non-zero value)
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator++(dynamic_bigint<T, Allocator>& a) {
+    return a += one<T>::value;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator++(dynamic_bigint<T, Allocator>& a, int) {
+    const dynamic_bigint<T, Allocator> previous = a;
+    a += one<T>::value;
+    return previous;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator--(dynamic_bigint<T, Allocator>& a) {
+    return a -= one<T>::value;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator--(dynamic_bigint<T, Allocator>& a, int) {
+    const dynamic_bigint<T, Allocator> previous = a;
+    a -= one<T>::value;
+    return previous;
+}
+
+/*
+ * '<<=' and '>>=' (Compound Shifts, a left shift grows the value)
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator<<=(dynamic_bigint<T, Allocator>& a, std::size_t shift) {
+    const std::size_t n = a.size();
+    if (n == 0) {
+        return a;
+    }
+    const std::size_t size = n + shift / std::numeric_limits<T>::digits + 1;
+    a.resize(size);
+    impl::shift_left_limbs(a.data(), size, a.data(), n, shift);
+    a.normalize();
+    return a;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator>& operator>>=(dynamic_bigint<T, Allocator>& a, std::size_t shift) {
+    const std::size_t limbs = shift / std::numeric_limits<T>::digits;
+    if (limbs >= a.size()) {
+        a.resize(0);
+        return a;
+    }
+    const std::size_t size = a.size() - limbs;
+    impl::shift_right_limbs(a.data(), size, a.data(), a.size(), shift);
+    a.resize(size);
+    a.normalize();
+    return a;
+}
+
+/*
+ * '<<' and '>>' (Shift Operators)
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator<<(const dynamic_bigint<T, Allocator>& a, std::size_t shift) {
+    dynamic_bigint<T, Allocator> result = a;
+    return result <<= shift;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator>>(const dynamic_bigint<T, Allocator>& a, std::size_t shift) {
+    dynamic_bigint<T, Allocator> result = a;
+    return result >>= shift;
+}
+
+/*
+ * '&', '|' and '^' (Bitwise Operators)
+ */
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator&(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    dynamic_bigint<T, Allocator> result(a.get_allocator());
+    result.resize(std::min(a.size(), b.size()));
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = static_cast<T>(a[i] & b[i]);
+    }
+    result.normalize();
+    return result;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator|(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    const dynamic_bigint<T, Allocator>& longer = a.size() < b.size() ? b : a;
+    const dynamic_bigint<T, Allocator>& shorter = a.size() < b.size() ? a : b;
+    dynamic_bigint<T, Allocator> result = longer;
+    for (std::size_t i = 0; i < shorter.size(); ++i) {
+        result[i] = static_cast<T>(result[i] | shorter[i]);
+    }
+    return result;
+}
+
+template<typename T, typename Allocator>
+dynamic_bigint<T, Allocator> operator^(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    const dynamic_bigint<T, Allocator>& longer = a.size() < b.size() ? b : a;
+    const dynamic_bigint<T, Allocator>& shorter = a.size() < b.size() ? a : b;
+    dynamic_bigint<T, Allocator> result = longer;
+    for (std::size_t i = 0; i < shorter.size(); ++i) {
+        result[i] = static_cast<T>(result[i] ^ shorter[i]);
+    }
+    result.normalize();
+    return result;
+}
+
+/*
+ * compare (Three-way comparison: negative, zero or positive as a < b, a == b or a > b)
+ *
+ * Normalized values with more limbs are larger, so only equal sizes reach
+ * the limb scan.
+ */
+template<typename T, typename Allocator>
+int compare(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    if (a.size() != b.size()) {
+        return a.size() < b.size() ? -1 : 1;
+    }
+    return impl::compare_limbs(a.data(), b.data(), a.size());
+}
+
+/*
+ * '==', '!=', '<', '<=', '>' and '>=' (Equality and Relational Operators)
+ */
+template<typename T, typename Allocator>
+bool operator==(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return compare(a, b) == 0;
+}
+
+template<typename T, typename Allocator>
+bool operator!=(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return compare(a, b) != 0;
+}
+
+template<typename T, typename Allocator>
+bool operator==(const dynamic_bigint<T, Allocator>& a, T b) {
+    return b == zero<T>::value ? a.size() == 0 : a.size() == 1 && a[0] == b;
+}
+
+template<typename T, typename Allocator>
+bool operator!=(const dynamic_bigint<T, Allocator>& a, T b) {
+    return !(a == b);
+}
+
+template<typename T, typename Allocator>
+bool operator<(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return compare(a, b) < 0;
+}
+
+template<typename T, typename Allocator>
+bool operator<=(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return compare(a, b) <= 0;
+}
+
+template<typename T, typename Allocator>
+bool operator>(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return compare(a, b) > 0;
+}
+
+template<typename T, typename Allocator>
+bool operator>=(const dynamic_bigint<T, Allocator>& a, const dynamic_bigint<T, Allocator>& b) {
+    return compare(a, b) >= 0;
+}
+
+/*
+ * parse_dynamic (Runtime text to dynamic_bigint, most significant digit first, no prefix or sign)
+ *
+ * Like parse, but the value grows to fit the text, so the only error is
+ * std::errc::invalid_argument for empty text or a character that is not a
+ * RADIX digit (position is its index).
+ */
+template<typename T = std::uint32_t, std::uint8_t RADIX = 10, typename Allocator = std::allocator<T>>
+parse_result<dynamic_bigint<T, Allocator>> parse_dynamic(std::string_view text, const Allocator& allocator = Allocator()) {
+    constexpr std::size_t LIMB_BITS = std::numeric_limits<T>::digits;
+    parse_result<dynamic_bigint<T, Allocator>> result = { dynamic_bigint<T, Allocator>(allocator), std::errc{}, 0 };
+    if (text.empty()) {
+        result.error = std::errc::invalid_argument;
+        return result;
+    }
+    std::vector<std::uint8_t> digits(text.size());
+    const std::size_t valid = parse_digits<RADIX>(text, digits.data());
+    if (valid != text.size()) {
+        result.error = std::errc::invalid_argument;
+        result.position = valid;
+        return result;
+    }
+    auto& value = result.value;
+
+    if constexpr (impl::radix_digit_bits<RADIX>::value > 0) {
+        constexpr std::size_t DIGIT_BITS = impl::radix_digit_bits<RADIX>::value;
+        value.resize((text.size() * DIGIT_BITS + LIMB_BITS - 1) / LIMB_BITS);
+        for (std::size_t i = 0; i < digits.size(); ++i) {
+            const T digit = static_cast<T>(digits[digits.size() - 1 - i]);
+            const std::size_t bit = i * DIGIT_BITS;
+            const std::size_t limb = bit / LIMB_BITS;
+            const int offset = static_cast<int>(bit % LIMB_BITS);
+            value[limb] = static_cast<T>(value[limb] | static_cast<T>(digit << offset));
+            if (offset + DIGIT_BITS > LIMB_BITS) {
+                value[limb + 1] = static_cast<T>(value[limb + 1] | static_cast<T>(digit >> (LIMB_BITS - offset)));
+            }
+        }
+    } else {
+        static_assert(RADIX == 10, "Unsupported radix");
+        // log2(10) < 3402 / 1024, so the bit length of the value is below this bound
+        value.resize((text.size() * 3402 / 1024 + LIMB_BITS) / LIMB_BITS);
+        impl::from_decimal_chunks(value.data(), value.size(), digits.data(), digits.size());
+    }
+    value.normalize();
+    return result;
+}
+
+/*
+ * to_string (Most significant digit first, "0" for zero)
+ */
+template<std::uint8_t RADIX = 10, typename T, typename Allocator>
+std::string to_string(const dynamic_bigint<T, Allocator>& v) {
+    constexpr std::size_t LIMB_BITS = std::numeric_limits<T>::digits;
+    if (v.size() == 0) {
+        return std::string(1, static_cast<char>(compose_digit<RADIX>(static_cast<std::uint8_t>(0))));
+    }
+    std::string digits;
+    if constexpr (RADIX == 10) {
+        // log10(2) < 78 / 256, plus a digit for the rounding
+        digits.resize(v.size() * LIMB_BITS * 78 / 256 + 2);
+        impl::limb_scratch<T, Allocator> scratch(v.get_allocator(), v.size());
+        std::copy(v.data(), v.data() + v.size(), scratch.data());
+        digits.resize(impl::to_decimal_chunks(digits.data(), scratch.data(), v.size(), 0));
+    } else {
+        constexpr std::size_t DIGIT_BITS = impl::radix_digit_bits<RADIX>::value;
+        static_assert(DIGIT_BITS > 0, "Unsupported radix");
+        const std::size_t used_bits = v.highest_bit();
+        for (std::size_t bit = 0; bit < used_bits; bit += DIGIT_BITS) {
+            const std::size_t limb = bit / LIMB_BITS;
+            const int offset = static_cast<int>(bit % LIMB_BITS);
+            T digit = static_cast<T>(v[limb] >> offset);
+            if (offset + DIGIT_BITS > LIMB_BITS && limb + 1 < v.size()) {
+                digit = static_cast<T>(digit | (v[limb + 1] << (LIMB_BITS - offset)));
+            }
+            digits.push_back(static_cast<char>(compose_digit<RADIX>(static_cast<std::uint8_t>(digit & (RADIX - 1)))));
+        }
+    }
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+} //namespace numbers
+
+namespace std {
+
+/*
+ * hash (Multiply-xorshift over the used limbs, for dynamic_bigint keys in unordered containers)
+ */
+template<typename T, typename Allocator>
+struct hash<::numbers::dynamic_bigint<T, Allocator>> {
+    std::size_t operator()(const ::numbers::dynamic_bigint<T, Allocator>& value) const noexcept {
+        std::uint64_t h = 0;
+        for (std::size_t i = 0; i < value.size(); ++i) {
+            h = (h ^ static_cast<std::uint64_t>(value[i])) * 0x9E3779B97F4A7C15u;
+            h ^= h >> 29;
+        }
+        return static_cast<std::size_t>(h ^ (h >> 32));
+    }
+};
+
+} //namespace std
+
+#endif//NUMBERS_DYNAMIC_HH
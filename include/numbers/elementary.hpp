@@ -1,6 +1,8 @@
 #ifndef NUMBERS_ARITHMETIC_HH
 #define NUMBERS_ARITHMETIC_HH
 
+#include <type_traits>
+
 namespace numbers {
 
 /*
@@ -136,9 +138,9 @@ constexpr auto divide(A a, B b) {
 }
 
 /*
- * logarithm
+ * logarithm (Built-in types only, bigint has its own overload)
  */
-template<typename V>
+template<typename V, typename = std::enable_if_t<std::is_arithmetic<V>::value>>
 constexpr V logarithm(V base, V value) {
     if (is_equal(value, one<V>::value)) {
         return zero<V>::value;
@@ -0,0 +1,221 @@
+#ifndef NUMBERS_EXPRESSION_HH
+#define NUMBERS_EXPRESSION_HH
+
+#include "bigint.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace numbers {
+namespace impl {
+
+/*
+ * is_bigint
+ */
+template<typename V>
+struct is_bigint : std::false_type {};
+
+template<std::size_t BITS, typename T>
+struct is_bigint<bigint<BITS, T>> : std::true_type {};
+
+/*
+ * is_expression (Lazily evaluated bigint expression nodes)
+ */
+template<typename V>
+struct is_expression : std::false_type {};
+
+} //namespace impl
+
+/*
+ * terminal_expression (A bigint operand of an expression, held by reference)
+ */
+template<std::size_t BITS, typename T>
+struct terminal_expression {
+    typedef T limb_type;
+    static constexpr std::size_t bits = BITS;
+
+    const bigint<BITS, T>& value;
+
+    constexpr const bigint<BITS, T>& operand() const {
+        return value;
+    }
+
+    template<std::size_t OUT_BITS>
+    constexpr void accumulate(bigint<OUT_BITS, T>& out) const {
+        out += value;
+    }
+};
+
+/*
+ * sum_expression (left + right, both added straight into the result)
+ */
+template<typename L, typename R>
+struct sum_expression {
+    typedef typename L::limb_type limb_type;
+    static constexpr std::size_t bits = impl::required_bits_addition<limb_type, L::bits, R::bits>::value;
+
+    L left;
+    R right;
+
+    constexpr bigint<bits, limb_type> operand() const {
+        bigint<bits, limb_type> result = {};
+        accumulate(result);
+        return result;
+    }
+
+    template<std::size_t OUT_BITS>
+    constexpr void accumulate(bigint<OUT_BITS, limb_type>& out) const {
+        left.accumulate(out);
+        right.accumulate(out);
+    }
+
+    constexpr operator bigint<bits, limb_type>() const {
+        return operand();
+    }
+};
+
+/*
+ * product_expression (left * right, multiply-accumulated row by row into the result)
+ *
+ * Compound operands are evaluated once at their own width; bigint operands
+ * are used in place.
+ */
+template<typename L, typename R>
+struct product_expression {
+    typedef typename L::limb_type limb_type;
+    static constexpr std::size_t bits = impl::required_bits_multiplication<limb_type, L::bits, R::bits>::value;
+
+    L left;
+    R right;
+
+    constexpr bigint<bits, limb_type> operand() const {
+        bigint<bits, limb_type> result = {};
+        accumulate(result);
+        return result;
+    }
+
+    template<std::size_t OUT_BITS>
+    constexpr void accumulate(bigint<OUT_BITS, limb_type>& out) const {
+        const auto& a = left.operand();
+        const auto& b = right.operand();
+        multiply_accumulate(out, a, b);
+    }
+
+    constexpr operator bigint<bits, limb_type>() const {
+        return operand();
+    }
+};
+
+namespace impl {
+
+template<std::size_t BITS, typename T>
+struct is_expression<terminal_expression<BITS, T>> : std::true_type {};
+
+template<typename L, typename R>
+struct is_expression<sum_expression<L, R>> : std::true_type {};
+
+template<typename L, typename R>
+struct is_expression<product_expression<L, R>> : std::true_type {};
+
+/*
+ * as_expression (Expression nodes as they are, bigint operands as terminals)
+ */
+template<std::size_t BITS, typename T>
+constexpr terminal_expression<BITS, T> as_expression(const bigint<BITS, T>& a) {
+    return { a };
+}
+
+template<typename E, typename = std::enable_if_t<is_expression<E>::value>>
+constexpr const E& as_expression(const E& e) {
+    return e;
+}
+
+/*
+ * expression_operands (At least one expression node, the other a node or a bigint)
+ */
+template<typename L, typename R>
+struct expression_operands : std::bool_constant<
+    (is_expression<L>::value && (is_expression<R>::value || is_bigint<R>::value))
+    || (is_bigint<L>::value && is_expression<R>::value)
+> {};
+
+} //namespace impl
+
+/*
+ * lazy (Starts an expression that is evaluated once, at its final width)
+ *
+ * Sums and products that involve an expression build further expression
+ * nodes instead of results. Converting to the final bigint, or calling
+ * evaluate, zeroes the result once and adds every term into it, with each
+ * product multiply-accumulated row by row. The bigint operands are held by
+ * reference, so an expression that refers to temporaries must be
+ * evaluated within the same full expression.
+ */
+template<std::size_t BITS, typename T>
+constexpr terminal_expression<BITS, T> lazy(const bigint<BITS, T>& a) {
+    return { a };
+}
+
+template<std::size_t BITS, typename T>
+void lazy(const bigint<BITS, T>&&) = delete;
+
+/*
+ * evaluate (The value of an expression, as wide as the expression requires)
+ */
+template<typename E, typename = std::enable_if_t<impl::is_expression<E>::value>>
+constexpr bigint<E::bits, typename E::limb_type> evaluate(const E& e) {
+    bigint<E::bits, typename E::limb_type> result = {};
+    e.accumulate(result);
+    return result;
+}
+
+/*
+ * '+' and '*' (Expression Operators)
+ */
+template<typename L, typename R, typename = std::enable_if_t<impl::expression_operands<L, R>::value>>
+constexpr auto operator+(const L& a, const R& b) {
+    typedef std::decay_t<decltype(impl::as_expression(a))> left_type;
+    typedef std::decay_t<decltype(impl::as_expression(b))> right_type;
+    static_assert(std::is_same<typename left_type::limb_type, typename right_type::limb_type>::value, "Operands must share a limb type");
+    return sum_expression<left_type, right_type>{ impl::as_expression(a), impl::as_expression(b) };
+}
+
+template<typename L, typename R, typename = std::enable_if_t<impl::expression_operands<L, R>::value>>
+constexpr auto operator*(const L& a, const R& b) {
+    typedef std::decay_t<decltype(impl::as_expression(a))> left_type;
+    typedef std::decay_t<decltype(impl::as_expression(b))> right_type;
+    static_assert(std::is_same<typename left_type::limb_type, typename right_type::limb_type>::value, "Operands must share a limb type");
+    return product_expression<left_type, right_type>{ impl::as_expression(a), impl::as_expression(b) };
+}
+
+} //namespace numbers
+
+/*
+ * lazy / evaluate
+ */
+static_assert([] {
+    const numbers::bigint<8, std::uint8_t> a = {200};
+    const numbers::bigint<8, std::uint8_t> b = {100};
+    const auto r = numbers::evaluate(numbers::lazy(a) + b);
+    return r.bits == 9 && r[0] == 44 && r[1] == 1;
+}());
+static_assert([] {
+    const numbers::bigint<16, std::uint8_t> a = {0xFF, 0xFF};
+    const numbers::bigint<8, std::uint8_t> b = {0xFF};
+    const auto r = numbers::evaluate(numbers::lazy(a) * b + a * numbers::lazy(b) + a);
+    return r.bits == 26 && r[0] == 0x01 && r[1] == 0xFE && r[2] == 0xFE && r[3] == 0x01;
+}());
+
+namespace numbers {
+static_assert([] {
+    constexpr auto a = 0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16;
+    constexpr auto b = 0xDEADBEEFCAFEBABE0123456789ABCDEFFEDCBA9876543210DEADBEEFCAFEBABE_16;
+    constexpr auto c = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F_16;
+    constexpr auto d = 0x90253886D88D8348A070D036E125A800179E21D583F27B6E65EDE62BEB2275A7_16;
+    const auto eager = a * b + c * d;
+    const bigint<eager.bits> fused = lazy(a) * b + lazy(c) * d;
+    return fused == eager && evaluate((lazy(a) + b) * (lazy(c) + d) * a) == multiply(multiply(a + b, c + d), a);
+}());
+} //namespace numbers
+
+#endif//NUMBERS_EXPRESSION_HH
@@ -0,0 +1,382 @@
+#ifndef NUMBERS_FIELD_HH
+#define NUMBERS_FIELD_HH
+
+#include "bigint.hpp"
+#include "gcd.hpp"
+#include "montgomery.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace numbers {
+namespace impl {
+
+/*
+ * signed_overflow_type (Signed type twice as wide as the limb, void when there is none)
+ */
+template<typename T>
+struct signed_overflow_type {
+    typedef void type;
+};
+
+template<>
+struct signed_overflow_type<std::uint8_t> {
+    typedef std::int16_t type;
+};
+
+template<>
+struct signed_overflow_type<std::uint16_t> {
+    typedef std::int32_t type;
+};
+
+template<>
+struct signed_overflow_type<std::uint32_t> {
+    typedef std::int64_t type;
+};
+
+#ifdef __SIZEOF_INT128__
+template<>
+struct signed_overflow_type<std::uint64_t> {
+    __extension__ typedef __int128 type;
+};
+#endif
+
+/*
+ * convert_limbs (The same value with a different limb type)
+ */
+template<typename T, std::size_t BITS, typename U>
+constexpr bigint<BITS, T> convert_limbs(const bigint<BITS, U>& a) {
+    constexpr std::size_t IN = std::numeric_limits<U>::digits;
+    constexpr std::size_t OUT = std::numeric_limits<T>::digits;
+    bigint<BITS, T> result = {};
+    for (std::size_t bit = 0; bit < a.count * IN && bit < result.count * OUT; ++bit) {
+        if ((a[bit / IN] >> (bit % IN)) & one<U>::value) {
+            result[bit / OUT] = static_cast<T>(result[bit / OUT] | static_cast<T>(one<T>::value << (bit % OUT)));
+        }
+    }
+    return result;
+}
+
+/*
+ * folding_table (Signed limb digits of 2^(digits * (N + j)) mod p for j in [0, N), centered on zero)
+ *
+ * For pseudo-Mersenne and Solinas primes every digit is small, so a
+ * double width product folds into N columns of signed sums. special is
+ * set when those sums cannot overflow and p fills its N limbs to within
+ * three bits.
+ */
+template<typename T, std::size_t N>
+struct folding_table {
+    typedef typename signed_overflow_type<T>::type overflow_type;
+    typedef std::conditional_t<std::is_void<overflow_type>::value, std::intmax_t, overflow_type> digit_type;
+
+    bool special;
+    std::array<std::array<digit_type, N>, N> rows;
+};
+
+/*
+ * make_folding_table
+ */
+template<typename T, std::size_t N>
+constexpr folding_table<T, N> make_folding_table(const std::array<T, N>& p) {
+    typedef typename folding_table<T, N>::digit_type S;
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    folding_table<T, N> table = {};
+    if constexpr (std::is_void<typename folding_table<T, N>::overflow_type>::value) {
+        return table;
+    } else {
+        const std::size_t used = used_limbs(p.data(), N);
+        table.special = used * DIGITS - count_leading_zeros(p[used - 1]) + 3 >= N * DIGITS;
+        std::array<T, N> half = {};
+        shift_right_limbs(half.data(), N, p.data(), N, 1);
+        for (std::size_t j = 0; j < N; ++j) {
+            std::array<T, 2 * N + 1> power = {};
+            std::array<T, 2 * N + 1> quotient = {};
+            std::array<T, N> value = {};
+            power[N + j] = one<T>::value;
+            divide_limbs<T, 2 * N + 1, N>(quotient.data(), value.data(), power.data(), p.data());
+            // Above p / 2 the representative value - p is the smaller one
+            std::array<T, N> difference = {};
+            const bool negative = subtract_limbs(difference.data(), half.data(), N, value.data(), N) != zero<T>::value;
+            if (negative) {
+                subtract_limbs(value.data(), p.data(), N, value.data(), N);
+            }
+            // Balanced digits in (-2^(digits - 1), 2^(digits - 1)], the top one takes the last carry
+            S carry = 0;
+            for (std::size_t i = 0; i < N; ++i) {
+                S digit = static_cast<S>(value[i]) + carry;
+                carry = 0;
+                if (i + 1 < N && digit > (S{1} << (DIGITS - 1))) {
+                    digit -= S{1} << DIGITS;
+                    carry = 1;
+                }
+                table.rows[j][i] = negative ? -digit : digit;
+            }
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            S sum = 0;
+            for (std::size_t j = 0; j < N; ++j) {
+                sum += table.rows[j][i] < 0 ? -table.rows[j][i] : table.rows[j][i];
+            }
+            if (sum >= (S{1} << (DIGITS - 2))) {
+                table.special = false;
+            }
+        }
+        return table;
+    }
+}
+
+/*
+ * fold_reduce (out[0, N) = x[0, 2N) mod p for a special folding table)
+ *
+ * TABLE is a template argument so that its zero digits drop out at
+ * compile time, leaving only the few products the prime needs.
+ */
+template<typename T, std::size_t N, const folding_table<T, N>& TABLE>
+constexpr void fold_reduce(T* out, const T* x, const std::array<T, N>& p) {
+    typedef typename folding_table<T, N>::digit_type S;
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    std::array<S, N> columns = {};
+    for (std::size_t i = 0; i < N; ++i) {
+        columns[i] = static_cast<S>(x[i]);
+        for (std::size_t j = 0; j < N; ++j) {
+            if (TABLE.rows[j][i] != 0) {
+                columns[i] += TABLE.rows[j][i] * static_cast<S>(x[N + j]);
+            }
+        }
+    }
+    // Carry the columns into limbs, whatever leaves the top is 2^(digits * N) times a small signed carry
+    S carry = 0;
+    auto propagate = [&]() {
+        for (std::size_t i = 0; i < N; ++i) {
+            const S value = columns[i] + carry;
+            out[i] = static_cast<T>(value);
+            carry = (value - static_cast<S>(out[i])) >> DIGITS;
+        }
+    };
+    propagate();
+    while (carry != 0) {
+        const S top = carry;
+        carry = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            columns[i] = static_cast<S>(out[i]) + top * TABLE.rows[0][i];
+        }
+        propagate();
+    }
+    std::array<T, N> difference = {};
+    while (subtract_limbs(difference.data(), out, N, p.data(), N) == zero<T>::value) {
+        for (std::size_t i = 0; i < N; ++i) {
+            out[i] = difference[i];
+        }
+    }
+}
+
+} //namespace impl
+
+/*
+ * prime_field (Arithmetic modulo the prime MODULUS::value, e.g. a _16 literal)
+ *
+ * Pseudo-Mersenne and Solinas primes reduce products by folding the high
+ * limbs through a table computed at compile time; any other prime uses
+ * Montgomery multiplication, with field elements kept in Montgomery form.
+ * to_field and from_field convert between integers and field elements.
+ */
+template<typename MODULUS, typename T = std::uint32_t>
+struct prime_field {
+    static constexpr std::size_t bits = std::decay_t<decltype(MODULUS::value)>::bits;
+    typedef bigint<bits, T> value_type;
+    static constexpr std::size_t count = value_type::count;
+
+    static constexpr value_type modulus = impl::convert_limbs<T>(MODULUS::value);
+    static constexpr impl::folding_table<T, count> folding = impl::make_folding_table<T, count>(modulus);
+    static constexpr bool special = folding.special;
+    static constexpr montgomery_context<bits, T> montgomery{modulus};
+
+    /*
+     * to_field
+     */
+    static constexpr value_type to_field(const value_type& a) {
+        if constexpr (special) {
+            std::array<T, 2 * count> x = {};
+            for (std::size_t i = 0; i < count; ++i) {
+                x[i] = a[i];
+            }
+            return reduce(x);
+        } else {
+            return montgomery.to_montgomery(a);
+        }
+    }
+
+    /*
+     * from_field
+     */
+    static constexpr value_type from_field(const value_type& a) {
+        if constexpr (special) {
+            return a;
+        } else {
+            return montgomery.from_montgomery(a);
+        }
+    }
+
+    /*
+     * add
+     */
+    static constexpr value_type add(const value_type& a, const value_type& b) {
+        value_type sum = {};
+        value_type difference = {};
+        const T carry = impl::add_limbs(sum.data(), a.data(), count, b.data(), count);
+        const T borrow = impl::subtract_limbs(difference.data(), sum.data(), count, modulus.data(), count);
+        return carry != zero<T>::value || borrow == zero<T>::value ? difference : sum;
+    }
+
+    /*
+     * subtract
+     */
+    static constexpr value_type subtract(const value_type& a, const value_type& b) {
+        value_type difference = {};
+        if (impl::subtract_limbs(difference.data(), a.data(), count, b.data(), count) != zero<T>::value) {
+            impl::add_limbs(difference.data(), difference.data(), count, modulus.data(), count);
+        }
+        return difference;
+    }
+
+    /*
+     * multiply
+     */
+    static constexpr value_type multiply(const value_type& a, const value_type& b) {
+        if constexpr (special) {
+            std::array<T, 2 * count> product = {};
+            impl::multiply_limbs<T, count, count, impl::karatsuba_threshold<T>::value, impl::toom3_threshold<T>::value>(
+                product.data(), a.data(), b.data());
+            return reduce(product);
+        } else {
+            return montgomery.mont_mul(a, b);
+        }
+    }
+
+    /*
+     * square
+     */
+    static constexpr value_type square(const value_type& a) {
+        if constexpr (special) {
+            std::array<T, 2 * count> product = {};
+            impl::square_limbs<T, count, impl::karatsuba_threshold<T>::value, impl::toom3_threshold<T>::value>(
+                product.data(), a.data());
+            return reduce(product);
+        } else {
+            return montgomery.mont_sqr(a);
+        }
+    }
+
+    /*
+     * inverse (Constant-time safegcd, zero has no inverse and maps to zero)
+     */
+    static constexpr value_type inverse(const value_type& a) {
+        if constexpr (special) {
+            return inverse_mod_constant_time(a, modulus);
+        } else {
+            // (a R)^-1 = a^-1 R^-1, and each multiply by R^2 brings back one R
+            const value_type inverted = inverse_mod_constant_time(a, modulus);
+            return montgomery.mont_mul(montgomery.mont_mul(inverted, montgomery.r2), montgomery.r2);
+        }
+    }
+
+    /*
+     * reduce (A double width product modulo the prime, special forms only)
+     */
+    static constexpr value_type reduce(const std::array<T, 2 * count>& x) {
+        static_assert(special, "reduce folds pseudo-Mersenne and Solinas primes only");
+        value_type result = {};
+        impl::fold_reduce<T, count, folding>(result.data(), x.data(), modulus);
+        return result;
+    }
+};
+
+/*
+ * secp256k1_modulus (2^256 - 2^32 - 977)
+ */
+struct secp256k1_modulus {
+    static constexpr auto value = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F_16;
+};
+
+/*
+ * p256_modulus (2^256 - 2^224 + 2^192 + 2^96 - 1)
+ */
+struct p256_modulus {
+    static constexpr auto value = 0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF_16;
+};
+
+/*
+ * curve25519_modulus (2^255 - 19)
+ */
+struct curve25519_modulus {
+    static constexpr auto value = 0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED_16;
+};
+
+} //namespace numbers
+
+/*
+ * folding_table
+ */
+static_assert(numbers::prime_field<numbers::secp256k1_modulus>::special);
+static_assert(numbers::prime_field<numbers::secp256k1_modulus, std::uint64_t>::special);
+static_assert(!numbers::prime_field<numbers::secp256k1_modulus, std::uint8_t>::special);
+static_assert(numbers::prime_field<numbers::secp256k1_modulus>::folding.rows[0][0] == 977);
+static_assert(numbers::prime_field<numbers::secp256k1_modulus>::folding.rows[0][1] == 1);
+static_assert(numbers::prime_field<numbers::p256_modulus>::special);
+static_assert(numbers::prime_field<numbers::p256_modulus>::folding.rows[0][0] == 1);
+static_assert(numbers::prime_field<numbers::p256_modulus>::folding.rows[0][3] == -1);
+static_assert(numbers::prime_field<numbers::p256_modulus>::folding.rows[0][6] == -1);
+static_assert(numbers::prime_field<numbers::p256_modulus>::folding.rows[0][7] == 1);
+static_assert(numbers::prime_field<numbers::p256_modulus, std::uint64_t>::special);
+static_assert(numbers::prime_field<numbers::curve25519_modulus, std::uint64_t>::special);
+static_assert(numbers::prime_field<numbers::curve25519_modulus, std::uint64_t>::folding.rows[0][0] == 38);
+
+/*
+ * prime_field
+ */
+namespace numbers {
+namespace {
+struct secp256k1_order {
+    static constexpr auto value = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141_16;
+};
+} //namespace
+
+static_assert(!prime_field<secp256k1_order>::special);
+static_assert([] {
+    typedef prime_field<secp256k1_modulus> F;
+    constexpr auto a = 0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16;
+    constexpr auto b = 0xDEADBEEFCAFEBABE0123456789ABCDEFFEDCBA9876543210DEADBEEFCAFEBABE_16;
+    return F::multiply(a, b) == 0x8224BF8F48395C3A01223A1DA3EF175743A2936643B0919C3A0F00EB9D58638E_16
+        && F::inverse(a) == 0x90253886D88D8348A070D036E125A800179E21D583F27B6E65EDE62BEB2275A7_16
+        && F::square(a) == F::multiply(a, a)
+        && F::subtract(F::add(a, b), b) == a
+        && F::add(F::subtract(bigint<256>{}, bigint<256>{1}), bigint<256>{1}) == bigint<256>{}
+        && F::to_field(F::modulus) == bigint<256>{};
+}());
+static_assert([] {
+    typedef prime_field<p256_modulus> F;
+    constexpr auto a = 0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16;
+    constexpr auto b = 0xDEADBEEFCAFEBABE0123456789ABCDEFFEDCBA9876543210DEADBEEFCAFEBABE_16;
+    return F::multiply(a, b) == 0x23FD83AF5E5B2445143E339E5900AAF3B96FD368BAC84FF78103E30912372F13_16
+        && F::inverse(a) == 0xF57A907F62B1233ABD5F3A6691BC288A1E870EED7FFA4C9ED7DA0063733DA9C2_16;
+}());
+static_assert([] {
+    typedef prime_field<secp256k1_order> F;
+    constexpr auto a = F::to_field(0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16);
+    constexpr auto b = F::to_field(0xDEADBEEFCAFEBABE0123456789ABCDEFFEDCBA9876543210DEADBEEFCAFEBABE_16);
+    return F::from_field(F::multiply(a, b)) == 0xBAD151CB6476051378EC3E1681A1486A17B44CDFC238B8F4E8B5643E406CF9F1_16
+        && F::from_field(F::inverse(a)) == 0xB48860FF32EBB69B5FCF8EAC11E42A487014065C75C2B2EF36D1A53D86013611_16;
+}());
+static_assert([] {
+    typedef prime_field<secp256k1_modulus, std::uint64_t> F;
+    constexpr auto a = impl::convert_limbs<std::uint64_t>(0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16);
+    constexpr auto b = impl::convert_limbs<std::uint64_t>(0xDEADBEEFCAFEBABE0123456789ABCDEFFEDCBA9876543210DEADBEEFCAFEBABE_16);
+    const auto p = F::multiply(a, b);
+    return p[0] == 0x3A0F00EB9D58638E && p[3] == 0x8224BF8F48395C3A;
+}());
+} //namespace numbers
+
+#endif//NUMBERS_FIELD_HH
@@ -0,0 +1,506 @@
+#ifndef NUMBERS_GCD_HH
+#define NUMBERS_GCD_HH
+
+#include "bigint.hpp"
+#include "montgomery.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace numbers {
+namespace impl {
+
+/*
+ * lehmer_cosequence (Euclid steps taken on leading words, as a 2x2 matrix with alternating signs)
+ *
+ * When even, x' = u0 * x - v0 * y and y' = v1 * y - u1 * x; otherwise
+ * both signs flip.
+ */
+template<typename T>
+struct lehmer_cosequence {
+    T u0;
+    T u1;
+    T v0;
+    T v1;
+    bool even;
+};
+
+/*
+ * lehmer_simulate (Quotients of a[0, n) / b that the top words determine, by Collins' condition)
+ *
+ * a >= b, n >= 2 and limbs of b past its used ones are zero. v0 is zero
+ * when not even one step could be simulated.
+ */
+template<typename T>
+constexpr lehmer_cosequence<T> lehmer_simulate(const T* a, const T* b, std::size_t n) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    const int h = count_leading_zeros(a[n - 1]);
+    auto leading = [&](const T* x) {
+        return h == 0 ? x[n - 1] : static_cast<T>(static_cast<T>(x[n - 1] << h) | static_cast<T>(x[n - 2] >> (DIGITS - h)));
+    };
+    T a1 = leading(a);
+    T a2 = leading(b);
+    lehmer_cosequence<T> c = { zero<T>::value, one<T>::value, zero<T>::value, zero<T>::value, false };
+    T u2 = zero<T>::value;
+    T v2 = one<T>::value;
+    // The cosequences never outgrow a word, see Jebelean, "Improving the multiprecision Euclidean algorithm"
+    while (a2 >= v2 && static_cast<T>(a1 - a2) >= static_cast<T>(c.v1 + v2)) {
+        const T q = static_cast<T>(a1 / a2);
+        const T r = static_cast<T>(a1 % a2);
+        a1 = a2;
+        a2 = r;
+        const T u3 = static_cast<T>(c.u1 + q * u2);
+        const T v3 = static_cast<T>(c.v1 + q * v2);
+        c.u0 = c.u1;
+        c.u1 = u2;
+        u2 = u3;
+        c.v0 = c.v1;
+        c.v1 = v2;
+        v2 = v3;
+        c.even = !c.even;
+    }
+    return c;
+}
+
+/*
+ * lehmer_update (x[0, n), y[0, n) = the cosequence applied to x, y, modulo 2^(digits * n))
+ */
+template<typename T, std::size_t N>
+constexpr void lehmer_update(T* x, T* y, std::size_t length, const lehmer_cosequence<T>& c) {
+    // Callers pass length <= N; the min makes that visible to the optimizer, so the
+    // subtractions below are not flagged by -Waggressive-loop-optimizations at -O1.
+    const std::size_t n = std::min(length, N);
+    std::array<T, N> ux = {};
+    std::array<T, N> vy = {};
+    std::array<T, N> uy = {};
+    std::array<T, N> vx = {};
+    multiply_add_row(ux.data(), x, n, c.u0);
+    multiply_add_row(vy.data(), y, n, c.v0);
+    multiply_add_row(vx.data(), x, n, c.u1);
+    multiply_add_row(uy.data(), y, n, c.v1);
+    if (c.even) {
+        subtract_limbs(x, ux.data(), n, vy.data(), n);
+        subtract_limbs(y, uy.data(), n, vx.data(), n);
+    } else {
+        subtract_limbs(x, vy.data(), n, ux.data(), n);
+        subtract_limbs(y, vx.data(), n, uy.data(), n);
+    }
+}
+
+/*
+ * lehmer_gcd (a = gcd(a, b), and with EXTENDED ua = ua * s + ub * t modulo 2^(digits * N) where gcd = s * a + t * b)
+ *
+ * Runs Euclid's algorithm a word of quotients at a time, falling back to
+ * a full division step whenever the leading words cannot decide one.
+ * Start from ua = 1 and ub = 0 to get the cofactor of a. b is clobbered.
+ */
+template<typename T, std::size_t N, bool EXTENDED>
+constexpr void lehmer_gcd(std::array<T, N>& a, std::array<T, N>& b, std::array<T, N>& ua, std::array<T, N>& ub) {
+    std::array<T, N> difference = {};
+    if (subtract_limbs(difference.data(), a.data(), N, b.data(), N) != zero<T>::value) {
+        // std::swap is not constexpr before C++20
+        difference = a;
+        a = b;
+        b = difference;
+        difference = ua;
+        ua = ub;
+        ub = difference;
+    }
+    auto euclid_step = [&]() {
+        std::array<T, N> q = {};
+        std::array<T, N> r = {};
+        divide_limbs<T, N, N>(q.data(), r.data(), a.data(), b.data());
+        a = b;
+        b = r;
+        if constexpr (EXTENDED) {
+            std::array<T, 2 * N> product = {};
+            multiply_limbs<T, N, N, karatsuba_threshold<T>::value, toom3_threshold<T>::value>(product.data(), q.data(), ub.data());
+            std::array<T, N> next = {};
+            subtract_limbs(next.data(), ua.data(), N, product.data(), N);
+            ua = ub;
+            ub = next;
+        }
+    };
+    while (used_limbs(b.data(), N) > 1) {
+        const std::size_t n = used_limbs(a.data(), N);
+        const lehmer_cosequence<T> c = lehmer_simulate(a.data(), b.data(), n);
+        if (c.v0 != zero<T>::value) {
+            lehmer_update<T, N>(a.data(), b.data(), n, c);
+            if constexpr (EXTENDED) {
+                lehmer_update<T, N>(ua.data(), ub.data(), N, c);
+            }
+        } else {
+            euclid_step();
+        }
+    }
+    if (b[0] == zero<T>::value) {
+        return;
+    }
+    if (used_limbs(a.data(), N) > 1) {
+        euclid_step();
+    }
+    // Both fit in a word, finish with single precision steps
+    T x = a[0];
+    T y = b[0];
+    lehmer_cosequence<T> c = { one<T>::value, zero<T>::value, zero<T>::value, one<T>::value, true };
+    while (y != zero<T>::value) {
+        const T q = static_cast<T>(x / y);
+        const T r = static_cast<T>(x % y);
+        x = y;
+        y = r;
+        const T u = static_cast<T>(c.u0 + q * c.u1);
+        const T v = static_cast<T>(c.v0 + q * c.v1);
+        c.u0 = c.u1;
+        c.u1 = u;
+        c.v0 = c.v1;
+        c.v1 = v;
+        c.even = !c.even;
+    }
+    a[0] = x;
+    b[0] = zero<T>::value;
+    if constexpr (EXTENDED) {
+        lehmer_update<T, N>(ua.data(), ub.data(), N, c);
+    }
+}
+
+/*
+ * is_negative_limbs (All ones when a[0, n) is negative in two's complement, zero otherwise)
+ */
+template<typename T>
+constexpr T is_negative_limbs(const T* a, std::size_t n) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    return static_cast<T>(zero<T>::value - static_cast<T>(a[n - 1] >> (DIGITS - 1)));
+}
+
+/*
+ * negate_limbs_masked (a[0, n) = mask ? -a : a without branching, mask is all ones or zero)
+ */
+template<typename T>
+constexpr void negate_limbs_masked(T* a, std::size_t n, T mask) {
+    T carry = static_cast<T>(mask & one<T>::value);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = add_carry(static_cast<T>(a[i] ^ mask), zero<T>::value, carry);
+    }
+}
+
+/*
+ * multiply_signed_limbs (out[0, n) = a[0, n) * c modulo 2^(digits * n), c a two's complement word)
+ */
+template<typename T>
+constexpr void multiply_signed_limbs(T* out, const T* a, std::size_t n, T c) {
+    const T sign = is_negative_limbs(&c, 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = zero<T>::value;
+    }
+    multiply_add_row(out, a, n, static_cast<T>((c ^ sign) - sign));
+    negate_limbs_masked(out, n, sign);
+}
+
+/*
+ * shift_right_signed_limbs (a[0, n) >>= shift in two's complement, 0 < shift < digits)
+ */
+template<typename T>
+constexpr void shift_right_signed_limbs(T* a, std::size_t n, int shift) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    const T sign = is_negative_limbs(a, n);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        a[i] = static_cast<T>((a[i] >> shift) | static_cast<T>(a[i + 1] << (DIGITS - shift)));
+    }
+    a[n - 1] = static_cast<T>((a[n - 1] >> shift) | static_cast<T>(sign << (DIGITS - shift)));
+}
+
+/*
+ * divsteps_batch (Bernstein-Yang transition matrix of divsteps over the low words of f and g)
+ *
+ * The matrix [u v; q r] maps (f, g) to 2^steps times the new (f, g). Its
+ * entries stay within 2^steps in magnitude, so steps = digits - 2 keeps
+ * them in two's complement words.
+ */
+template<typename T>
+struct divsteps_batch {
+    T u;
+    T v;
+    T q;
+    T r;
+};
+
+/*
+ * divsteps (steps divsteps of (delta, f, g) on the low words, f odd, without branching on any of them)
+ */
+template<typename T>
+constexpr divsteps_batch<T> divsteps(std::int64_t& delta, T f, T g, int steps) {
+    typedef decltype(T{} + 0u) W;
+    divsteps_batch<T> m = { one<T>::value, zero<T>::value, zero<T>::value, one<T>::value };
+    for (int i = 0; i < steps; ++i) {
+        // delta > 0 and g odd: (1 - delta, g, (g - f) / 2), g odd: (1 + delta, f, (g + f) / 2), else (1 + delta, f, g / 2)
+        const T positive = static_cast<T>(zero<T>::value - static_cast<T>(static_cast<std::uint64_t>(-delta) >> 63));
+        const T odd = static_cast<T>(zero<T>::value - static_cast<T>(g & one<T>::value));
+        g = static_cast<T>(g + (static_cast<T>((f ^ positive) - positive) & odd));
+        m.q = static_cast<T>(m.q + (static_cast<T>((m.u ^ positive) - positive) & odd));
+        m.r = static_cast<T>(m.r + (static_cast<T>((m.v ^ positive) - positive) & odd));
+        const T swap = static_cast<T>(positive & odd);
+        const std::int64_t flip = -static_cast<std::int64_t>(swap & one<T>::value);
+        delta = (delta ^ flip) - flip + 1;
+        f = static_cast<T>(f + (g & swap));
+        m.u = static_cast<T>(m.u + (m.q & swap));
+        m.v = static_cast<T>(m.v + (m.r & swap));
+        g = static_cast<T>(g >> 1);
+        m.u = static_cast<T>(static_cast<W>(m.u) << 1);
+        m.v = static_cast<T>(static_cast<W>(m.v) << 1);
+    }
+    return m;
+}
+
+/*
+ * divsteps_iterations (Divsteps that bring g to zero for any f, g below 2^bits, Bernstein-Yang theorem 11.2)
+ */
+constexpr std::size_t divsteps_iterations(std::size_t bits) {
+    return bits < 46 ? (49 * bits + 57) / 17 : (49 * bits + 80) / 17;
+}
+
+/*
+ * reduce_signed_limbs (a in (-m, 2m) to [0, m) without branching)
+ */
+template<typename T, std::size_t N>
+constexpr void reduce_signed_limbs(std::array<T, N>& a, const std::array<T, N>& m) {
+    const T negative = is_negative_limbs(a.data(), N);
+    T carry = zero<T>::value;
+    for (std::size_t i = 0; i < N; ++i) {
+        a[i] = add_carry(a[i], static_cast<T>(m[i] & negative), carry);
+    }
+    std::array<T, N> difference = {};
+    const T borrow = subtract_limbs(difference.data(), a.data(), N, m.data(), N);
+    select_limbs(a.data(), difference.data(), N, static_cast<T>(zero<T>::value - static_cast<T>(borrow ^ one<T>::value)));
+}
+
+/*
+ * safegcd_inverse (out[0, N) = a^-1 mod m for odd m, zero when a is not invertible)
+ *
+ * Bernstein-Yang divsteps in batches of digits - 2, for a fixed number of
+ * batches that depends only on N. With f = m and g = a, d and e track
+ * d * a = f and e * a = g modulo m; every batch adds the multiple of m
+ * that makes d and e divisible by 2^(digits - 2). Nothing branches on or
+ * indexes by a or m.
+ */
+template<typename T, std::size_t N>
+constexpr void safegcd_inverse(T* out, const T* a, const T* m) {
+    typedef decltype(T{} + 0u) W;
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    constexpr int STEPS = DIGITS - 2;
+    constexpr std::size_t BATCHES = (divsteps_iterations(N * DIGITS) + STEPS - 1) / STEPS;
+    // One limb of headroom holds the sign and the 2^STEPS growth of every matrix product
+    constexpr std::size_t L = N + 1;
+    const T inverse = negated_inverse(m[0]);
+    const T low = static_cast<T>((one<T>::value << STEPS) - 1u);
+
+    std::array<T, L> modulus = {};
+    std::array<T, L> f = {};
+    std::array<T, L> g = {};
+    std::array<T, L> d = {};
+    std::array<T, L> e = {};
+    for (std::size_t i = 0; i < N; ++i) {
+        modulus[i] = m[i];
+        f[i] = m[i];
+        g[i] = a[i];
+    }
+    e[0] = one<T>::value;
+    std::int64_t delta = 1;
+
+    std::array<T, L> x0 = {};
+    std::array<T, L> x1 = {};
+    std::array<T, L> y0 = {};
+    std::array<T, L> y1 = {};
+    auto transition = [&](std::array<T, L>& x, std::array<T, L>& y, const divsteps_batch<T>& t) {
+        multiply_signed_limbs(x0.data(), x.data(), L, t.u);
+        multiply_signed_limbs(x1.data(), y.data(), L, t.v);
+        multiply_signed_limbs(y0.data(), x.data(), L, t.q);
+        multiply_signed_limbs(y1.data(), y.data(), L, t.r);
+        add_limbs(x.data(), x0.data(), L, x1.data(), L);
+        add_limbs(y.data(), y0.data(), L, y1.data(), L);
+    };
+    for (std::size_t batch = 0; batch < BATCHES; ++batch) {
+        const divsteps_batch<T> t = divsteps(delta, f[0], g[0], STEPS);
+        transition(f, g, t);
+        shift_right_signed_limbs(f.data(), L, STEPS);
+        shift_right_signed_limbs(g.data(), L, STEPS);
+        transition(d, e, t);
+        multiply_add_row(d.data(), modulus.data(), L, static_cast<T>(static_cast<T>(static_cast<W>(d[0]) * inverse) & low));
+        multiply_add_row(e.data(), modulus.data(), L, static_cast<T>(static_cast<T>(static_cast<W>(e[0]) * inverse) & low));
+        shift_right_signed_limbs(d.data(), L, STEPS);
+        shift_right_signed_limbs(e.data(), L, STEPS);
+        reduce_signed_limbs(d, modulus);
+        reduce_signed_limbs(e, modulus);
+    }
+
+    // g is zero and f = +-gcd(a, m)
+    const T negative = is_negative_limbs(f.data(), L);
+    negate_limbs_masked(f.data(), L, negative);
+    negate_limbs_masked(d.data(), L, negative);
+    reduce_signed_limbs(d, modulus);
+    T rest = static_cast<T>(f[0] ^ one<T>::value);
+    for (std::size_t i = 1; i < L; ++i) {
+        rest = static_cast<T>(rest | f[i]);
+    }
+    const T nonzero = static_cast<T>(static_cast<T>(rest | static_cast<T>(zero<T>::value - rest)) >> (DIGITS - 1));
+    const T invertible = static_cast<T>(nonzero - one<T>::value);
+    for (std::size_t i = 0; i < N; ++i) {
+        out[i] = static_cast<T>(d[i] & invertible);
+    }
+}
+
+} //namespace impl
+
+/*
+ * gcd (Lehmer's algorithm)
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto gcd(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    constexpr std::size_t BITS = std::max(A_BITS, B_BITS);
+    bigint<BITS, T> x = of<T, A_BITS, BITS>(a);
+    bigint<BITS, T> y = of<T, B_BITS, BITS>(b);
+    bigint<BITS, T> ux = {};
+    bigint<BITS, T> uy = {};
+    impl::lehmer_gcd<T, bigint<BITS, T>::count, false>(x, y, ux, uy);
+    return x;
+}
+
+/*
+ * extended_gcd_result
+ */
+template<typename V>
+struct extended_gcd_result {
+    V gcd;
+    V x;
+    V y;
+};
+
+/*
+ * extended_gcd (gcd = a * x + b * y, with x and y in two's complement over the full limbs)
+ *
+ * x and y wrap like subtract does, the top bit of the top limb is the
+ * sign. They are the cofactors of Euclid's algorithm, at most b / (2 gcd)
+ * and a / (2 gcd) in magnitude, so they always fit.
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto extended_gcd(const bigint<A_BITS, T>& a, const bigint<B_BITS, T>& b) {
+    constexpr std::size_t BITS = std::max(A_BITS, B_BITS);
+    constexpr std::size_t N = bigint<BITS, T>::count;
+    extended_gcd_result<bigint<BITS, T>> result = {};
+    result.gcd = of<T, A_BITS, BITS>(a);
+    bigint<BITS, T> y = of<T, B_BITS, BITS>(b);
+    bigint<BITS, T> uy = {};
+    result.x[0] = one<T>::value;
+    impl::lehmer_gcd<T, N, true>(result.gcd, y, result.x, uy);
+
+    // y = (gcd - a * x) / b exactly, through |x| and the sign of the numerator
+    const bigint<BITS, T> divisor = of<T, B_BITS, BITS>(b);
+    if (impl::used_limbs(divisor.data(), N) == 0) {
+        return result;
+    }
+    bigint<BITS, T> magnitude = result.x;
+    const T negative = impl::is_negative_limbs(magnitude.data(), N);
+    impl::negate_limbs_masked(magnitude.data(), N, negative);
+    const bigint<BITS, T> multiplicand = of<T, A_BITS, BITS>(a);
+    std::array<T, 2 * N> numerator = {};
+    impl::multiply_limbs<T, N, N, impl::karatsuba_threshold<T>::value, impl::toom3_threshold<T>::value>(
+        numerator.data(), multiplicand.data(), magnitude.data());
+    // Negative x: gcd + a|x| > 0; otherwise a * x - gcd, which is negative only when x = 0
+    bool positive = negative != zero<T>::value;
+    if (positive) {
+        impl::add_limbs(numerator.data(), numerator.data(), 2 * N, result.gcd.data(), N);
+    } else if (impl::subtract_limbs(numerator.data(), numerator.data(), 2 * N, result.gcd.data(), N) != zero<T>::value) {
+        impl::negate_limbs(numerator.data(), 2 * N);
+        positive = true;
+    }
+    std::array<T, 2 * N> quotient = {};
+    std::array<T, N> remainder = {};
+    impl::divide_limbs<T, 2 * N, N>(quotient.data(), remainder.data(), numerator.data(), divisor.data());
+    for (std::size_t i = 0; i < N; ++i) {
+        result.y[i] = quotient[i];
+    }
+    if (!positive) {
+        impl::negate_limbs(result.y.data(), N);
+    }
+    return result;
+}
+
+/*
+ * inverse_mod (a^-1 mod m, zero when gcd(a, m) is not one, m must be non-zero)
+ */
+template<typename T, std::size_t A_BITS, std::size_t M_BITS>
+constexpr bigint<M_BITS, T> inverse_mod(const bigint<A_BITS, T>& a, const bigint<M_BITS, T>& m) {
+    constexpr std::size_t N = bigint<M_BITS, T>::count;
+    bigint<M_BITS, T> x = modulo(a, m);
+    bigint<M_BITS, T> y = m;
+    bigint<M_BITS, T> ux = { one<T>::value };
+    bigint<M_BITS, T> uy = {};
+    impl::lehmer_gcd<T, N, true>(x, y, ux, uy);
+    if (!(x == one<T>::value)) {
+        return {};
+    }
+    if (impl::is_negative_limbs(ux.data(), N) != zero<T>::value) {
+        impl::add_limbs(ux.data(), ux.data(), N, m.data(), N);
+    }
+    return ux;
+}
+
+/*
+ * inverse_mod_constant_time (a^-1 mod m for odd m by safegcd, zero when a is not invertible)
+ *
+ * The running time depends only on BITS and T, for secret a and m.
+ */
+template<typename T, std::size_t BITS>
+constexpr bigint<BITS, T> inverse_mod_constant_time(const bigint<BITS, T>& a, const bigint<BITS, T>& m) {
+    bigint<BITS, T> result = {};
+    impl::safegcd_inverse<T, bigint<BITS, T>::count>(result.data(), a.data(), m.data());
+    return result;
+}
+
+} //namespace numbers
+
+/*
+ * gcd
+ */
+static_assert(numbers::gcd(numbers::bigint<16, std::uint8_t>{240}, numbers::bigint<16, std::uint8_t>{46})[0] == 2);
+static_assert(numbers::gcd(numbers::bigint<16, std::uint8_t>{0}, numbers::bigint<16, std::uint8_t>{46})[0] == 46);
+static_assert(numbers::gcd(numbers::bigint<24, std::uint8_t>{0x00, 0x1B, 0xB7}, numbers::bigint<32, std::uint8_t>{0xC0, 0x0E, 0x16, 0x02})[1] == 0x42);
+
+/*
+ * extended_gcd
+ */
+static_assert([] {
+    const auto e = numbers::extended_gcd(numbers::bigint<16, std::uint8_t>{240}, numbers::bigint<16, std::uint8_t>{46});
+    return e.gcd[0] == 2 && e.x[0] == 0xF7 && e.x[1] == 0xFF && e.y[0] == 47 && e.y[1] == 0;
+}());
+static_assert([] {
+    const auto e = numbers::extended_gcd(numbers::bigint<16, std::uint8_t>{46}, numbers::bigint<16, std::uint8_t>{240});
+    return e.gcd[0] == 2 && e.x[0] == 47 && e.y[0] == 0xF7 && e.y[1] == 0xFF;
+}());
+static_assert([] {
+    const auto e = numbers::extended_gcd(numbers::bigint<32>{7}, numbers::bigint<32>{0});
+    return e.gcd[0] == 7 && e.x[0] == 1 && e.y[0] == 0;
+}());
+
+/*
+ * inverse_mod
+ */
+static_assert(numbers::inverse_mod(numbers::bigint<16, std::uint8_t>{17}, numbers::bigint<16, std::uint8_t>{0x30, 0x0C})[0] == 0xC1);
+static_assert(numbers::inverse_mod(numbers::bigint<16, std::uint8_t>{17}, numbers::bigint<16, std::uint8_t>{0x30, 0x0C})[1] == 0x0A);
+static_assert(numbers::inverse_mod(numbers::bigint<16, std::uint8_t>{6}, numbers::bigint<16, std::uint8_t>{9})[0] == 0);
+static_assert(numbers::inverse_mod_constant_time(numbers::bigint<16, std::uint8_t>{17}, numbers::bigint<16, std::uint8_t>{0x31, 0x0C})[0] == 0x96);
+static_assert(numbers::inverse_mod_constant_time(numbers::bigint<16, std::uint8_t>{6}, numbers::bigint<16, std::uint8_t>{9})[0] == 0);
+
+namespace numbers {
+static_assert(gcd(0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16,
+                  0xDEADBEEFCAFEBABE0123456789ABCDEFFEDCBA9876543210DEADBEEFCAFEBABE_16) == bigint<32>{6});
+static_assert([] {
+    constexpr auto p = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F_16;
+    constexpr auto a = 0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16;
+    constexpr auto inverse = 0x90253886D88D8348A070D036E125A800179E21D583F27B6E65EDE62BEB2275A7_16;
+    return inverse_mod(a, p) == inverse && inverse_mod_constant_time(a, p) == inverse;
+}());
+} //namespace numbers
+
+#endif//NUMBERS_GCD_HH
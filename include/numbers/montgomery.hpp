@@ -0,0 +1,326 @@
+#ifndef NUMBERS_MONTGOMERY_HH
+#define NUMBERS_MONTGOMERY_HH
+
+#include "bigint.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace numbers {
+namespace impl {
+
+/*
+ * negated_inverse (-n^-1 mod 2^digits for odd n, by Newton iteration)
+ */
+template<typename T>
+constexpr T negated_inverse(T n) {
+    // Unsigned arithmetic at least as wide as int, so small limbs never promote to signed
+    typedef decltype(T{} + 0u) W;
+    // n * n = 1 mod 8 for every odd n, each step doubles the correct bits
+    T x = n;
+    for (int bits = 3; bits < std::numeric_limits<T>::digits; bits *= 2) {
+        x = static_cast<T>(static_cast<W>(x) * static_cast<T>(2u - static_cast<W>(n) * x));
+    }
+    return static_cast<T>(0u - static_cast<W>(x));
+}
+
+/*
+ * select_limbs (out[0, n) = mask ? a[0, n) : out[0, n) without branching, mask is all ones or zero)
+ */
+template<typename T>
+constexpr void select_limbs(T* out, const T* a, std::size_t n, T mask) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<T>((a[i] & mask) | (out[i] & static_cast<T>(~mask)));
+    }
+}
+
+/*
+ * exponent_bit
+ */
+template<typename T, std::size_t BITS>
+constexpr T exponent_bit(const bigint<BITS, T>& exponent, std::size_t i) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    return static_cast<T>((exponent[i / DIGITS] >> (i % DIGITS)) & one<T>::value);
+}
+
+/*
+ * exponent_window (Sliding window width for an exponent of the given bit length)
+ */
+constexpr int exponent_window(std::size_t bits) {
+    return bits <= 8 ? 1 : bits <= 24 ? 2 : bits <= 80 ? 3 : bits <= 240 ? 4 : bits <= 672 ? 5 : 6;
+}
+
+/*
+ * max_exponent_window
+ */
+struct max_exponent_window : identity<int, 6> {};
+
+/*
+ * fixed_exponent_window (Window width of the constant-time exponentiation, from the exponent type alone)
+ */
+template<std::size_t BITS>
+struct fixed_exponent_window : identity<int, BITS <= 64 ? 2 : BITS <= 512 ? 4 : 5> {};
+
+/*
+ * montgomery_reduce (out[0, n) = t[0, 2n) / R mod m for t < m * R, t is clobbered)
+ */
+template<typename T>
+constexpr void montgomery_reduce(T* out, T* t, const T* m, std::size_t n, T inverse) {
+    typedef decltype(T{} + 0u) W;
+    T extra = zero<T>::value;
+    for (std::size_t i = 0; i < n; ++i) {
+        const T q = static_cast<T>(static_cast<W>(t[i]) * inverse);
+        const T carry = multiply_add_row(t + i, m, n, q);
+        t[i + n] = add_carry(t[i + n], carry, extra);
+    }
+    // Keep t / R when it is already below m, without branching on the value
+    const T borrow = subtract_limbs(out, t + n, n, m, n);
+    select_limbs(out, t + n, n, static_cast<T>(zero<T>::value - static_cast<T>(borrow & ~extra)));
+}
+
+} //namespace impl
+
+/*
+ * montgomery_context (Arithmetic modulo an odd modulus in Montgomery form, R = 2^(count * digits))
+ *
+ * Values in Montgomery form are a * R mod modulus. Inputs to mont_mul and
+ * mont_sqr must be below the modulus; to_montgomery accepts any value.
+ */
+template<std::size_t BITS, typename T = std::uint32_t>
+struct montgomery_context {
+    typedef bigint<BITS, T> value_type;
+    static constexpr std::size_t count = value_type::count;
+
+    value_type modulus;
+    value_type r;       // R mod modulus, the Montgomery form of 1
+    value_type r2;      // R^2 mod modulus
+    T inverse;          // -modulus^-1 mod 2^digits
+
+    constexpr explicit montgomery_context(const value_type& m) :
+        modulus(m),
+        r{},
+        r2{},
+        inverse(impl::negated_inverse(m[0]))
+    {
+        std::array<T, count + 1> power = {};
+        std::array<T, count + 1> quotient = {};
+        power[count] = one<T>::value;
+        impl::divide_limbs<T, count + 1, count>(quotient.data(), r.data(), power.data(), modulus.data());
+        std::array<T, 2 * count + 1> square = {};
+        std::array<T, 2 * count + 1> square_quotient = {};
+        square[2 * count] = one<T>::value;
+        impl::divide_limbs<T, 2 * count + 1, count>(square_quotient.data(), r2.data(), square.data(), modulus.data());
+    }
+
+    /*
+     * mont_mul (a * b / R mod modulus, coarsely integrated operand scanning)
+     */
+    constexpr value_type mont_mul(const value_type& a, const value_type& b) const {
+        typedef decltype(T{} + 0u) W;
+        std::array<T, 2 * count + 2> t = {};
+        for (std::size_t i = 0; i < count; ++i) {
+            // The window t[i, i + count + 2) holds the running value, t[i] is zero after the reduction step
+            T* w = t.data() + i;
+            T carry = zero<T>::value;
+            w[count] = impl::add_carry(w[count], impl::multiply_add_row(w, a.data(), count, b[i]), carry);
+            w[count + 1] = carry;
+            const T q = static_cast<T>(static_cast<W>(w[0]) * inverse);
+            carry = zero<T>::value;
+            w[count] = impl::add_carry(w[count], impl::multiply_add_row(w, modulus.data(), count, q), carry);
+            w[count + 1] = static_cast<T>(w[count + 1] + carry);
+        }
+        value_type result = {};
+        const T borrow = impl::subtract_limbs(result.data(), t.data() + count, count, modulus.data(), count);
+        impl::select_limbs(result.data(), t.data() + count, count,
+            static_cast<T>(zero<T>::value - static_cast<T>(borrow & ~t[2 * count])));
+        return result;
+    }
+
+    /*
+     * mont_sqr (a * a / R mod modulus, a full square followed by a separate reduction)
+     */
+    constexpr value_type mont_sqr(const value_type& a) const {
+        std::array<T, 2 * count> t = {};
+        impl::square_limbs<T, count, impl::karatsuba_threshold<T>::value, impl::toom3_threshold<T>::value>(t.data(), a.data());
+        value_type result = {};
+        impl::montgomery_reduce(result.data(), t.data(), modulus.data(), count, inverse);
+        return result;
+    }
+
+    /*
+     * to_montgomery
+     */
+    constexpr value_type to_montgomery(const value_type& a) const {
+        return mont_mul(a, r2);
+    }
+
+    /*
+     * from_montgomery
+     */
+    constexpr value_type from_montgomery(const value_type& a) const {
+        std::array<T, 2 * count> t = {};
+        for (std::size_t i = 0; i < count; ++i) {
+            t[i] = a[i];
+        }
+        value_type result = {};
+        impl::montgomery_reduce(result.data(), t.data(), modulus.data(), count, inverse);
+        return result;
+    }
+
+    /*
+     * pow_mod (base^exponent mod modulus, left-to-right sliding window over precomputed odd powers)
+     *
+     * The window width follows the bit length of the exponent, so timing
+     * depends on the exponent; use pow_mod_constant_time for secrets.
+     */
+    template<std::size_t EXPONENT_BITS>
+    constexpr value_type pow_mod(const value_type& base, const bigint<EXPONENT_BITS, T>& exponent) const {
+        const std::size_t used = exponent.used_limbs();
+        if (used == 0) {
+            return from_montgomery(r);
+        }
+        const std::size_t bits = exponent.highest_bit(used);
+        const int window = impl::exponent_window(bits);
+
+        // odd[i] = base^(2i + 1)
+        std::array<value_type, std::size_t{1} << (impl::max_exponent_window::value - 1)> odd = {};
+        odd[0] = to_montgomery(base);
+        const value_type square = mont_sqr(odd[0]);
+        for (std::size_t i = 1; i < (std::size_t{1} << (window - 1)); ++i) {
+            odd[i] = mont_mul(odd[i - 1], square);
+        }
+
+        value_type result = r;
+        bool started = false;
+        std::size_t i = bits;
+        while (i > 0) {
+            if (impl::exponent_bit(exponent, i - 1) == zero<T>::value) {
+                result = mont_sqr(result);
+                --i;
+                continue;
+            }
+            // Longest window of at most `window` bits starting at bit i - 1 and ending in a one
+            std::size_t low = i > static_cast<std::size_t>(window) ? i - window : 0;
+            while (impl::exponent_bit(exponent, low) == zero<T>::value) {
+                ++low;
+            }
+            std::size_t value = 0;
+            for (std::size_t j = i; j > low; --j) {
+                value = (value << 1) | impl::exponent_bit(exponent, j - 1);
+                if (started) {
+                    result = mont_sqr(result);
+                }
+            }
+            result = started ? mont_mul(result, odd[value >> 1]) : odd[value >> 1];
+            started = true;
+            i = low;
+        }
+        return from_montgomery(result);
+    }
+
+    /*
+     * pow_mod_constant_time (base^exponent mod modulus, fixed window with masked table lookups)
+     *
+     * Every bit of the exponent type is processed and every table entry is
+     * read, so the sequence of operations and memory accesses depends only
+     * on BITS and EXPONENT_BITS.
+     */
+    template<std::size_t EXPONENT_BITS>
+    constexpr value_type pow_mod_constant_time(const value_type& base, const bigint<EXPONENT_BITS, T>& exponent) const {
+        typedef decltype(T{} + 0u) W;
+        constexpr int DIGITS = std::numeric_limits<T>::digits;
+        constexpr int WINDOW = impl::fixed_exponent_window<EXPONENT_BITS>::value;
+        constexpr std::size_t BITS_TOTAL = bigint<EXPONENT_BITS, T>::count * DIGITS;
+        constexpr std::size_t WINDOWS = (BITS_TOTAL + WINDOW - 1) / WINDOW;
+
+        // powers[i] = base^i
+        std::array<value_type, std::size_t{1} << WINDOW> powers = {};
+        powers[0] = r;
+        powers[1] = to_montgomery(base);
+        for (std::size_t i = 2; i < powers.size(); ++i) {
+            powers[i] = mont_mul(powers[i - 1], powers[1]);
+        }
+
+        auto lookup = [&powers](std::size_t index) {
+            value_type entry = {};
+            for (std::size_t i = 0; i < powers.size(); ++i) {
+                const T mask = static_cast<T>(zero<T>::value - static_cast<T>(static_cast<W>(i == index)));
+                for (std::size_t j = 0; j < count; ++j) {
+                    entry[j] = static_cast<T>(entry[j] | (powers[i][j] & mask));
+                }
+            }
+            return entry;
+        };
+        auto window_at = [&exponent](std::size_t w) {
+            std::size_t value = 0;
+            for (int j = WINDOW; j > 0; --j) {
+                const std::size_t i = w * WINDOW + static_cast<std::size_t>(j - 1);
+                value = (value << 1) | (i < BITS_TOTAL ? impl::exponent_bit(exponent, i) : zero<T>::value);
+            }
+            return value;
+        };
+
+        // Squares go through mont_mul, the square_limbs fast paths branch on the data
+        value_type result = lookup(window_at(WINDOWS - 1));
+        for (std::size_t w = WINDOWS - 1; w > 0; --w) {
+            for (int j = 0; j < WINDOW; ++j) {
+                result = mont_mul(result, result);
+            }
+            result = mont_mul(result, lookup(window_at(w - 1)));
+        }
+        return from_montgomery(result);
+    }
+};
+
+} //namespace numbers
+
+/*
+ * negated_inverse
+ */
+static_assert(static_cast<std::uint8_t>(numbers::impl::negated_inverse<std::uint8_t>(197) * 197) == 0xFF);
+static_assert(static_cast<std::uint16_t>(numbers::impl::negated_inverse<std::uint16_t>(0xFFF1) * 0xFFF1u) == 0xFFFF);
+static_assert(numbers::impl::negated_inverse<std::uint32_t>(1000000007) * 1000000007u == 0xFFFFFFFF);
+static_assert(numbers::impl::negated_inverse<std::uint64_t>(0xFFFFFFFFFFFFFFED) * 0xFFFFFFFFFFFFFFEDull == 0xFFFFFFFFFFFFFFFF);
+
+/*
+ * montgomery_context
+ */
+static_assert(numbers::montgomery_context<8, std::uint8_t>({197}).r[0] == 59);
+static_assert(numbers::montgomery_context<8, std::uint8_t>({197}).r2[0] == 132);
+static_assert(numbers::montgomery_context<8, std::uint8_t>({197}).pow_mod({2}, numbers::bigint<8, std::uint8_t>{100})[0] == 193);
+static_assert(numbers::montgomery_context<32, std::uint32_t>({1000000007}).pow_mod({3}, numbers::bigint<32, std::uint32_t>{200})[0] == 136318165);
+static_assert(numbers::montgomery_context<32, std::uint32_t>({1000000007}).pow_mod({2}, numbers::bigint<32, std::uint32_t>{1000000006})[0] == 1);
+static_assert(numbers::montgomery_context<32, std::uint32_t>({1000000007}).from_montgomery(
+    numbers::montgomery_context<32, std::uint32_t>({1000000007}).to_montgomery({123456789}))[0] == 123456789);
+static_assert([] {
+    constexpr numbers::montgomery_context<128, std::uint32_t> m({0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF});
+    const auto v = m.pow_mod({5}, numbers::bigint<32, std::uint32_t>{12345});
+    return v[0] == 0x0C8F99C5 && v[1] == 0xA843F32F && v[2] == 0x311B32E3 && v[3] == 0x02A962AD;
+}());
+static_assert([] {
+    constexpr numbers::montgomery_context<128, std::uint32_t> m({0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF});
+    const auto v = m.pow_mod_constant_time({5}, numbers::bigint<32, std::uint32_t>{12345});
+    return v[0] == 0x0C8F99C5 && v[1] == 0xA843F32F && v[2] == 0x311B32E3 && v[3] == 0x02A962AD;
+}());
+static_assert(numbers::montgomery_context<32, std::uint32_t>({1000000007}).pow_mod({3}, numbers::bigint<32, std::uint32_t>{0})[0] == 1);
+static_assert(numbers::montgomery_context<32, std::uint32_t>({1000000007}).pow_mod_constant_time({3}, numbers::bigint<32, std::uint32_t>{0})[0] == 1);
+static_assert(numbers::montgomery_context<32, std::uint32_t>({1000000007}).pow_mod_constant_time({3}, numbers::bigint<32, std::uint32_t>{200})[0] == 136318165);
+static_assert([] {
+    constexpr numbers::montgomery_context<128, std::uint64_t> m({0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF});
+    const auto v = m.pow_mod({7}, numbers::bigint<128, std::uint64_t>{3, 1});
+    return v[0] == 0x9F01EA6B198CE555 && v[1] == 0x720927629101CD23;
+}());
+static_assert([] {
+    // 2^255 - 19 and the Montgomery form of the curve25519 constant 121666
+    constexpr numbers::montgomery_context<256, std::uint64_t> m({
+        0xFFFFFFFFFFFFFFED, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF });
+    constexpr auto a24 = m.to_montgomery({121666});
+    const auto fermat = m.pow_mod({2}, numbers::bigint<256, std::uint64_t>{
+        0xFFFFFFFFFFFFFFEC, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF });
+    const auto secret = m.pow_mod_constant_time({2}, numbers::bigint<256, std::uint64_t>{
+        0xFFFFFFFFFFFFFFEC, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF });
+    return a24[0] == 0x468BCC && a24[1] == 0 && a24[3] == 0 && fermat[0] == 1 && fermat[1] == 0 && secret == fermat;
+}());
+
+#endif//NUMBERS_MONTGOMERY_HH
@@ -0,0 +1,52 @@
+#ifndef NUMBERS_PLATFORM_HH
+#define NUMBERS_PLATFORM_HH
+
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define NUMBERS_X86_64 1
+#include <immintrin.h>
+#endif
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_bitops)
+#include <bit>
+#elif defined(__GNUC__)
+// GCC and Clang evaluate __builtin_clz, __builtin_ctz and __builtin_popcount in constant expressions
+#define NUMBERS_BIT_BUILTINS 1
+#endif
+
+namespace numbers {
+namespace impl {
+
+/*
+ * is_constant_evaluated (True during constant evaluation, always true when the compiler cannot tell)
+ *
+ * Runtime-only fast paths (SIMD, intrinsics) branch on this so the same
+ * constexpr function keeps its portable code at compile time.
+ */
+constexpr bool is_constant_evaluated() {
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+#elif defined(__GNUC__) && __GNUC__ >= 9
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+} //namespace impl
+} //namespace numbers
+
+#endif//NUMBERS_PLATFORM_HH
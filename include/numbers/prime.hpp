@@ -0,0 +1,513 @@
+#ifndef NUMBERS_PRIME_HH
+#define NUMBERS_PRIME_HH
+
+#include "bigint.hpp"
+#include "montgomery.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace numbers {
+namespace impl {
+
+/*
+ * small_prime_count (Odd primes used for trial division and the residue sieve)
+ */
+struct small_prime_count : identity<std::size_t, 1024> {};
+
+/*
+ * make_small_primes (The first COUNT odd primes, by trial division)
+ */
+template<std::size_t COUNT>
+constexpr std::array<std::uint16_t, COUNT> make_small_primes() {
+    std::array<std::uint16_t, COUNT> primes = {};
+    std::size_t found = 0;
+    for (std::uint32_t candidate = 3; found < COUNT; candidate += 2) {
+        bool prime = true;
+        for (std::size_t i = 0; i < found && primes[i] * primes[i] <= candidate; ++i) {
+            if (candidate % primes[i] == 0) {
+                prime = false;
+                break;
+            }
+        }
+        if (prime) {
+            primes[found++] = static_cast<std::uint16_t>(candidate);
+        }
+    }
+    return primes;
+}
+
+/*
+ * small_primes
+ */
+constexpr auto small_primes = make_small_primes<small_prime_count::value>();
+
+/*
+ * residue (a[0, n) mod p for a small p)
+ */
+template<typename T>
+constexpr std::uint32_t residue(const T* a, std::size_t n, std::uint32_t p) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    if constexpr (DIGITS <= 16) {
+        std::uint32_t remainder = 0;
+        for (std::size_t i = n; i > 0; --i) {
+            remainder = ((remainder << DIGITS) | a[i - 1]) % p;
+        }
+        return remainder;
+    } else {
+        T remainder = zero<T>::value;
+        for (std::size_t i = n; i > 0; --i) {
+            divide_wide(remainder, a[i - 1], static_cast<T>(p), remainder);
+        }
+        return static_cast<std::uint32_t>(remainder);
+    }
+}
+
+/*
+ * residue_sieve (A candidate's residues modulo the small primes, advanced by a fixed even step)
+ *
+ * Stepping adds the step's residues instead of dividing again, so
+ * sieving a run of candidates costs one pass over the table each.
+ */
+struct residue_sieve {
+    std::array<std::uint16_t, small_prime_count::value> residues;
+    std::array<std::uint16_t, small_prime_count::value> steps;
+
+    template<typename T>
+    constexpr residue_sieve(const T* a, std::size_t n, std::size_t step) :
+        residues{},
+        steps{}
+    {
+        for (std::size_t i = 0; i < small_prime_count::value; ++i) {
+            residues[i] = static_cast<std::uint16_t>(residue(a, n, small_primes[i]));
+            steps[i] = static_cast<std::uint16_t>(step % small_primes[i]);
+        }
+    }
+
+    /*
+     * advance
+     */
+    constexpr void advance() {
+        for (std::size_t i = 0; i < small_prime_count::value; ++i) {
+            const std::uint32_t next = std::uint32_t{residues[i]} + steps[i];
+            residues[i] = static_cast<std::uint16_t>(next >= small_primes[i] ? next - small_primes[i] : next);
+        }
+    }
+
+    /*
+     * has_small_factor (True when a small prime divides the candidate)
+     */
+    constexpr bool has_small_factor() const {
+        bool found = false;
+        for (std::size_t i = 0; i < small_prime_count::value; ++i) {
+            found |= residues[i] == 0;
+        }
+        return found;
+    }
+};
+
+/*
+ * jacobi (Jacobi symbol (a / n) of words, n odd)
+ */
+template<typename W>
+constexpr int jacobi(W a, W n) {
+    int result = 1;
+    a %= n;
+    while (a != 0) {
+        while (a % 2 == 0) {
+            a /= 2;
+            if (n % 8 == 3 || n % 8 == 5) {
+                result = -result;
+            }
+        }
+        const W t = a;
+        a = n;
+        n = t;
+        if (a % 4 == 3 && n % 4 == 3) {
+            result = -result;
+        }
+        a %= n;
+    }
+    return n == 1 ? result : 0;
+}
+
+/*
+ * is_square (True when a is a perfect square)
+ */
+template<typename T, std::size_t BITS>
+constexpr bool is_square(const bigint<BITS, T>& a) {
+    return square(integer_sqrt(a)) == a;
+}
+
+/*
+ * add_mod (a + b mod n for a, b below n)
+ */
+template<typename T, std::size_t BITS>
+constexpr bigint<BITS, T> add_mod(const bigint<BITS, T>& a, const bigint<BITS, T>& b, const bigint<BITS, T>& n) {
+    constexpr std::size_t N = bigint<BITS, T>::count;
+    bigint<BITS, T> sum = {};
+    bigint<BITS, T> difference = {};
+    const T carry = add_limbs(sum.data(), a.data(), N, b.data(), N);
+    const T borrow = subtract_limbs(difference.data(), sum.data(), N, n.data(), N);
+    return carry != zero<T>::value || borrow == zero<T>::value ? difference : sum;
+}
+
+/*
+ * subtract_mod (a - b mod n for a, b below n)
+ */
+template<typename T, std::size_t BITS>
+constexpr bigint<BITS, T> subtract_mod(const bigint<BITS, T>& a, const bigint<BITS, T>& b, const bigint<BITS, T>& n) {
+    constexpr std::size_t N = bigint<BITS, T>::count;
+    bigint<BITS, T> difference = {};
+    if (subtract_limbs(difference.data(), a.data(), N, b.data(), N) != zero<T>::value) {
+        add_limbs(difference.data(), difference.data(), N, n.data(), N);
+    }
+    return difference;
+}
+
+/*
+ * half_mod (a / 2 mod n for a below n, n odd)
+ */
+template<typename T, std::size_t BITS>
+constexpr bigint<BITS, T> half_mod(bigint<BITS, T> a, const bigint<BITS, T>& n) {
+    constexpr std::size_t N = bigint<BITS, T>::count;
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    T carry = zero<T>::value;
+    if (a[0] & one<T>::value) {
+        carry = add_limbs(a.data(), a.data(), N, n.data(), N);
+    }
+    shift_right_limbs(a.data(), N, a.data(), N, 1);
+    a[N - 1] = static_cast<T>(a[N - 1] | static_cast<T>(carry << (DIGITS - 1)));
+    return a;
+}
+
+/*
+ * trailing_zeros (Trailing zero bits of a non-zero a[0, n))
+ */
+template<typename T>
+constexpr std::size_t trailing_zeros(const T* a, std::size_t n) {
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    std::size_t zeros = 0;
+    for (std::size_t i = 0; i < n && a[i] == zero<T>::value; ++i) {
+        zeros += DIGITS;
+    }
+    return zeros + static_cast<std::size_t>(count_trailing_zeros(a[zeros / DIGITS]));
+}
+
+/*
+ * baillie_psw (Miller-Rabin to base 2 and the strong Lucas test, n odd and free of small factors)
+ */
+template<typename T, std::size_t BITS>
+constexpr bool baillie_psw(const bigint<BITS, T>& n);
+
+} //namespace impl
+
+/*
+ * miller_rabin (True when n is a strong probable prime to the base, n odd and above 2)
+ */
+template<typename T, std::size_t BITS>
+constexpr bool miller_rabin(const bigint<BITS, T>& n, const bigint<BITS, T>& base) {
+    constexpr std::size_t N = bigint<BITS, T>::count;
+    const montgomery_context<BITS, T> context(n);
+    // n - 1 = d * 2^s with d odd
+    bigint<BITS, T> d = {};
+    const T borrow_in[1] = { one<T>::value };
+    impl::subtract_limbs(d.data(), n.data(), N, borrow_in, 1);
+    const std::size_t s = impl::trailing_zeros(d.data(), N);
+    impl::shift_right_limbs(d.data(), N, d.data(), N, s);
+
+    bigint<BITS, T> minus_one = {};
+    impl::subtract_limbs(minus_one.data(), n.data(), N, context.r.data(), N);
+    bigint<BITS, T> x = context.to_montgomery(context.pow_mod(base, d));
+    if (x == context.r || x == minus_one) {
+        return true;
+    }
+    for (std::size_t i = 1; i < s; ++i) {
+        x = context.mont_sqr(x);
+        if (x == minus_one) {
+            return true;
+        }
+        if (x == context.r) {
+            return false;
+        }
+    }
+    return false;
+}
+
+/*
+ * strong_lucas (True when n is a strong Lucas probable prime with Selfridge's parameters, n odd and above 2)
+ *
+ * D is the first of 5, -7, 9, -11, ... with Jacobi symbol (D / n) = -1,
+ * P = 1 and Q = (1 - D) / 4. Perfect squares, which have no such D, and
+ * n sharing a factor with D are reported composite.
+ */
+template<typename T, std::size_t BITS>
+constexpr bool strong_lucas(const bigint<BITS, T>& n) {
+    constexpr std::size_t N = bigint<BITS, T>::count;
+    constexpr int DIGITS = std::numeric_limits<T>::digits;
+    std::uint64_t small = 0;
+    const bool fits = impl::to_word(n.data(), N, small);
+    std::int64_t D = 5;
+    for (int attempt = 0;; ++attempt) {
+        const std::uint64_t magnitude = static_cast<std::uint64_t>(D < 0 ? -D : D);
+        // (D / n) = (n mod |D| / |D|) by reciprocity, with (-1 / n) for a negative D
+        int symbol = impl::jacobi<std::uint64_t>(impl::residue(n.data(), N, static_cast<std::uint32_t>(magnitude)), magnitude);
+        if (magnitude % 4 == 3 && (n[0] & 3u) == 3u) {
+            symbol = -symbol;
+        }
+        if (D < 0 && (n[0] & 3u) == 3u) {
+            symbol = -symbol;
+        }
+        if (symbol == -1) {
+            break;
+        }
+        if (symbol == 0 && !(fits && small == magnitude)) {
+            return false;
+        }
+        if (attempt == 8 && impl::is_square(n)) {
+            return false;
+        }
+        D = D < 0 ? 2 - D : -2 - D;
+    }
+    const montgomery_context<BITS, T> context(n);
+    auto from_small = [&](std::int64_t value) {
+        const bigint<BITS, T> magnitude = context.to_montgomery({ static_cast<T>(value < 0 ? -value : value) });
+        return value < 0 ? impl::subtract_mod(bigint<BITS, T>{}, magnitude, n) : magnitude;
+    };
+    const bigint<BITS, T> d_value = from_small(D);
+    const bigint<BITS, T> q_value = from_small((1 - D) / 4);
+
+    // n + 1 = d * 2^s with d odd
+    std::array<T, N + 1> plus_one = {};
+    const T increment[1] = { one<T>::value };
+    plus_one[N] = impl::add_limbs(plus_one.data(), n.data(), N, increment, 1);
+    const std::size_t s = impl::trailing_zeros(plus_one.data(), N + 1);
+    std::array<T, N + 1> d = {};
+    impl::shift_right_limbs(d.data(), N + 1, plus_one.data(), N + 1, s);
+    const std::size_t used = impl::used_limbs(d.data(), N + 1);
+    const std::size_t bits = used * DIGITS - impl::count_leading_zeros(d[used - 1]);
+
+    // U_1 = 1, V_1 = P = 1, Q^1
+    bigint<BITS, T> u = context.r;
+    bigint<BITS, T> v = context.r;
+    bigint<BITS, T> qk = q_value;
+    for (std::size_t i = bits - 1; i > 0; --i) {
+        // U_2k = U_k V_k, V_2k = V_k^2 - 2 Q^k
+        u = context.mont_mul(u, v);
+        v = impl::subtract_mod(context.mont_sqr(v), impl::add_mod(qk, qk, n), n);
+        qk = context.mont_sqr(qk);
+        if ((d[(i - 1) / DIGITS] >> ((i - 1) % DIGITS)) & one<T>::value) {
+            // U_k+1 = (U_k + V_k) / 2, V_k+1 = (D U_k + V_k) / 2
+            const bigint<BITS, T> next = impl::half_mod(impl::add_mod(u, v, n), n);
+            v = impl::half_mod(impl::add_mod(context.mont_mul(d_value, u), v, n), n);
+            u = next;
+            qk = context.mont_mul(qk, q_value);
+        }
+    }
+    const bigint<BITS, T> zero_value = {};
+    if (u == zero_value || v == zero_value) {
+        return true;
+    }
+    for (std::size_t r = 1; r < s; ++r) {
+        v = impl::subtract_mod(context.mont_sqr(v), impl::add_mod(qk, qk, n), n);
+        if (v == zero_value) {
+            return true;
+        }
+        qk = context.mont_sqr(qk);
+    }
+    return false;
+}
+
+namespace impl {
+
+template<typename T, std::size_t BITS>
+constexpr bool baillie_psw(const bigint<BITS, T>& n) {
+    return miller_rabin(n, bigint<BITS, T>{ two<T>::value }) && strong_lucas(n);
+}
+
+} //namespace impl
+
+/*
+ * is_probable_prime (Baillie-PSW after trial division by the small primes)
+ *
+ * No composite is known to pass, and none exists below 2^64.
+ */
+template<typename T, std::size_t BITS>
+constexpr bool is_probable_prime(const bigint<BITS, T>& n) {
+    constexpr std::size_t N = bigint<BITS, T>::count;
+    constexpr std::uint64_t LARGEST = impl::small_primes[impl::small_prime_count::value - 1];
+    std::uint64_t small = 0;
+    const bool fits = impl::to_word(n.data(), N, small);
+    if (fits && small < 3) {
+        return small == 2;
+    }
+    if ((n[0] & one<T>::value) == zero<T>::value) {
+        return false;
+    }
+    for (const std::uint16_t p : impl::small_primes) {
+        if (impl::residue(n.data(), N, p) == 0) {
+            return fits && small == p;
+        }
+    }
+    // Every composite below the square of the largest small prime has a small factor
+    if (fits && small < LARGEST * LARGEST) {
+        return true;
+    }
+    return impl::baillie_psw(n);
+}
+
+namespace impl {
+
+/*
+ * thread_joiner (Joins every joinable thread on scope exit, so unwinding never destroys a running one)
+ */
+class thread_joiner {
+public:
+    explicit thread_joiner(std::vector<std::thread>& source) noexcept :
+        threads(source)
+    {}
+
+    thread_joiner(const thread_joiner&) = delete;
+    thread_joiner& operator=(const thread_joiner&) = delete;
+
+    ~thread_joiner() {
+        for (std::thread& thread : threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+
+private:
+    std::vector<std::thread>& threads;
+};
+
+} //namespace impl
+
+/*
+ * next_prime (Smallest probable prime above n, zero when none fits in the limbs)
+ *
+ * Candidates are odd numbers sieved by their residues modulo the small
+ * primes, and survivors take the Baillie-PSW test. With several threads,
+ * thread t takes candidates t, t + threads, ... and the smallest prime
+ * found wins, so the result does not depend on the thread count.
+ */
+template<typename T, std::size_t BITS>
+bigint<BITS, T> next_prime(const bigint<BITS, T>& n, std::size_t threads = 1) {
+    constexpr std::size_t N = bigint<BITS, T>::count;
+    constexpr std::uint16_t LARGEST = impl::small_primes[impl::small_prime_count::value - 1];
+    // Below the largest small prime the answer is in the table, and the sieve only handles larger candidates
+    std::uint64_t small = 0;
+    if (impl::to_word(n.data(), N, small) && small < LARGEST) {
+        const std::uint64_t next = small < 2 ? 2 : *std::upper_bound(impl::small_primes.begin(), impl::small_primes.end(), small);
+        bigint<BITS, T> result = {};
+        return impl::from_word(result.data(), N, next) ? result : bigint<BITS, T>{};
+    }
+
+    // First odd candidate above n
+    bigint<BITS, T> first = n;
+    const T step_in[1] = { static_cast<T>((n[0] & one<T>::value) ? 2u : 1u) };
+    if (impl::add_limbs(first.data(), first.data(), N, step_in, 1) != zero<T>::value) {
+        return {};
+    }
+
+    threads = std::max<std::size_t>(threads, 1);
+    const std::size_t none = std::numeric_limits<std::size_t>::max();
+    std::atomic<std::size_t> best(none);
+    std::vector<std::size_t> found(threads, none);
+    std::vector<bigint<BITS, T>> primes(threads);
+
+    auto search = [&](std::size_t offset) {
+        bigint<BITS, T> candidate = first;
+        std::array<T, N> step = {};
+        if (!impl::from_word(step.data(), N, 2 * offset)
+            || impl::add_limbs(candidate.data(), candidate.data(), N, step.data(), N) != zero<T>::value) {
+            return;
+        }
+        // Candidates of this thread are 2 * threads apart
+        if (!impl::from_word(step.data(), N, 2 * threads)) {
+            return;
+        }
+        impl::residue_sieve sieve(candidate.data(), N, 2 * threads);
+        for (std::size_t index = offset; index < best.load(std::memory_order_relaxed); index += threads) {
+            if (!sieve.has_small_factor() && impl::baillie_psw(candidate)) {
+                found[offset] = index;
+                primes[offset] = candidate;
+                std::size_t current = best.load();
+                while (index < current && !best.compare_exchange_weak(current, index)) {
+                }
+                return;
+            }
+            if (impl::add_limbs(candidate.data(), candidate.data(), N, step.data(), N) != zero<T>::value) {
+                return;
+            }
+            sieve.advance();
+        }
+    };
+
+    // If starting a thread throws, the ones already running are stopped and joined before rethrowing
+    std::vector<std::thread> workers;
+    {
+        impl::thread_joiner joiner(workers);
+        try {
+            for (std::size_t t = 1; t < threads; ++t) {
+                workers.emplace_back(search, t);
+            }
+        } catch (...) {
+            best.store(0);
+            throw;
+        }
+        search(0);
+    }
+    const std::size_t winner = best.load();
+    for (std::size_t t = 0; t < threads; ++t) {
+        if (found[t] == winner && winner != none) {
+            return primes[t];
+        }
+    }
+    return {};
+}
+
+} //namespace numbers
+
+/*
+ * miller_rabin
+ */
+static_assert(numbers::miller_rabin(numbers::bigint<16, std::uint16_t>{2047}, numbers::bigint<16, std::uint16_t>{2}));
+static_assert(numbers::miller_rabin(numbers::bigint<16, std::uint16_t>{3277}, numbers::bigint<16, std::uint16_t>{2}));
+static_assert(!numbers::miller_rabin(numbers::bigint<16, std::uint16_t>{2047}, numbers::bigint<16, std::uint16_t>{3}));
+static_assert(!numbers::miller_rabin(numbers::bigint<16, std::uint16_t>{561}, numbers::bigint<16, std::uint16_t>{2}));
+static_assert(numbers::miller_rabin(numbers::bigint<32, std::uint32_t>{1000000007}, numbers::bigint<32, std::uint32_t>{2}));
+
+/*
+ * strong_lucas
+ */
+static_assert(numbers::strong_lucas(numbers::bigint<16, std::uint16_t>{5459}));
+static_assert(numbers::strong_lucas(numbers::bigint<16, std::uint16_t>{5777}));
+static_assert(!numbers::miller_rabin(numbers::bigint<16, std::uint16_t>{5459}, numbers::bigint<16, std::uint16_t>{2}));
+static_assert(!numbers::strong_lucas(numbers::bigint<16, std::uint16_t>{2047}));
+static_assert(!numbers::strong_lucas(numbers::bigint<16, std::uint16_t>{3277}));
+static_assert(numbers::strong_lucas(numbers::bigint<32, std::uint32_t>{1000000007}));
+
+/*
+ * is_probable_prime
+ */
+static_assert(!numbers::is_probable_prime(numbers::bigint<8, std::uint8_t>{0}));
+static_assert(!numbers::is_probable_prime(numbers::bigint<8, std::uint8_t>{1}));
+static_assert(numbers::is_probable_prime(numbers::bigint<8, std::uint8_t>{2}));
+static_assert(numbers::is_probable_prime(numbers::bigint<8, std::uint8_t>{251}));
+static_assert(!numbers::is_probable_prime(numbers::bigint<16, std::uint8_t>{0x31, 0x02}));
+static_assert(!numbers::is_probable_prime(numbers::bigint<32, std::uint32_t>{2047}));
+static_assert(!numbers::is_probable_prime(numbers::bigint<32, std::uint32_t>{5459}));
+static_assert(!numbers::is_probable_prime(numbers::bigint<32, std::uint32_t>{3215031751}));
+static_assert(numbers::is_probable_prime(numbers::bigint<32, std::uint32_t>{1000000007}));
+static_assert(numbers::is_probable_prime(numbers::bigint<64, std::uint64_t>{0xFFFFFFFFFFFFFFC5}));
+static_assert(numbers::is_probable_prime(numbers::bigint<64, std::uint16_t>{0xFFC5, 0xFFFF, 0xFFFF, 0xFFFF}));
+static_assert(!numbers::is_probable_prime(numbers::bigint<64, std::uint64_t>{0xFFFFFFFFFFFFFFC3}));
+
+#endif//NUMBERS_PRIME_HH
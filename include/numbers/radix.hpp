@@ -5,8 +5,16 @@
 
 #include <array>
 #include <limits>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "elementary.hpp"
+#include "platform.hpp"
 
 namespace numbers {
 namespace impl {
@@ -111,7 +119,19 @@ parse_digit(const char c) {
         /* 224-239 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         /* 240-255 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
     };
-    return _[c];
+    return _[static_cast<unsigned char>(c)];
+}
+
+/*
+ * compose_digit (Base 2)
+ */
+template<std::uint8_t RADIX, typename V = std::uint8_t>
+constexpr typename std::enable_if<RADIX == 2, V>::type
+compose_digit(V d) {
+    constexpr std::array<const char, RADIX> _ = {
+        '0', '1'
+    };
+    return _[d];
 }
 
 /*
@@ -138,7 +158,7 @@ parse_digit(const char c) {
         /* 224-239 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         /* 240-255 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
     };
-    return _[c];
+    return _[static_cast<unsigned char>(c)];
 }
 
 /*
@@ -177,7 +197,7 @@ parse_digit(const char c) {
         /* 224-239 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         /* 240-255 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
     };
-    return _[c];
+    return _[static_cast<unsigned char>(c)];
 }
 
 /*
@@ -216,7 +236,7 @@ parse_digit(const char c) {
         /* 224-239 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         /* 240-255 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
     };
-    return _[c];
+    return _[static_cast<unsigned char>(c)];
 }
 
 /*
@@ -244,7 +264,7 @@ parse_digit(const char c) {
         /* 032-047 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 63,
         /* 048-063 */ 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0, 0, 0, 0, 0, 0,
         /* 064-079 */ 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
-        /* 080-095 */ 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 0, 0, 0,
+        /* 080-095 */ 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 0,
         /* 096-111 */ 0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
         /* 112-127 */ 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0, 0, 0, 0, 0,
         /* 128-143 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -256,7 +276,7 @@ parse_digit(const char c) {
         /* 224-239 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         /* 240-255 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
     };
-    return _[c];
+    return _[static_cast<unsigned char>(c)];
 }
 
 /*
@@ -278,6 +298,159 @@ compose_digit(V d) {
     return _[d];
 }
 
+/*
+ * is_digit (Derived from the parse_digit and compose_digit tables)
+ */
+template<std::uint8_t RADIX = 10>
+constexpr bool is_digit(const char c) {
+    return parse_digit<RADIX>(c) != 0 || c == static_cast<char>(compose_digit<RADIX>(0));
+}
+
+namespace impl {
+
+/*
+ * digit_range (Consecutive characters that parse to consecutive digits)
+ */
+struct digit_range {
+    unsigned char first;
+    unsigned char length;
+    unsigned char digit;
+};
+
+/*
+ * count_digit_ranges
+ */
+template<std::uint8_t RADIX>
+constexpr std::size_t count_digit_ranges() {
+    std::size_t count = 0;
+    for (unsigned c = 0; c < 256; ++c) {
+        const char current = static_cast<char>(c);
+        const char previous = static_cast<char>(c - 1);
+        if (!is_digit<RADIX>(current)) {
+            continue;
+        }
+        if (c == 0 || !is_digit<RADIX>(previous) ||
+            parse_digit<RADIX>(current) != parse_digit<RADIX>(previous) + 1) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/*
+ * make_digit_ranges (The parse_digit table as a list of ranges, for the SIMD kernels)
+ */
+template<std::uint8_t RADIX>
+constexpr auto make_digit_ranges() {
+    std::array<digit_range, count_digit_ranges<RADIX>()> ranges = {};
+    std::size_t count = 0;
+    for (unsigned c = 0; c < 256; ++c) {
+        const char current = static_cast<char>(c);
+        const char previous = static_cast<char>(c - 1);
+        if (!is_digit<RADIX>(current)) {
+            continue;
+        }
+        if (c == 0 || !is_digit<RADIX>(previous) ||
+            parse_digit<RADIX>(current) != parse_digit<RADIX>(previous) + 1) {
+            ranges[count++] = {
+                static_cast<unsigned char>(c),
+                0,
+                parse_digit<RADIX>(current)
+            };
+        }
+        ++ranges[count - 1].length;
+    }
+    return ranges;
+}
+
+#if defined(__AVX2__)
+/*
+ * parse_digits_avx2 (Converts 32 characters at a time, stops before the first block holding an invalid one)
+ */
+template<std::uint8_t RADIX>
+inline std::size_t parse_digits_avx2(const char* text, std::size_t length, std::uint8_t* digits) {
+    constexpr auto ranges = make_digit_ranges<RADIX>();
+    std::size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+        __m256i valid = _mm256_setzero_si256();
+        __m256i value = _mm256_setzero_si256();
+        for (const auto& range : ranges) {
+            const __m256i offset = _mm256_sub_epi8(c, _mm256_set1_epi8(static_cast<char>(range.first)));
+            const __m256i limit = _mm256_set1_epi8(static_cast<char>(range.length - 1));
+            const __m256i in = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, limit), offset);
+            const __m256i digit = _mm256_add_epi8(offset, _mm256_set1_epi8(static_cast<char>(range.digit)));
+            valid = _mm256_or_si256(valid, in);
+            value = _mm256_or_si256(value, _mm256_and_si256(in, digit));
+        }
+        if (_mm256_movemask_epi8(valid) != -1) {
+            break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(digits + i), value);
+    }
+    return i;
+}
+#endif
+
+#if defined(__SSE2__)
+/*
+ * parse_digits_sse2 (Converts 16 characters at a time, stops before the first block holding an invalid one)
+ */
+template<std::uint8_t RADIX>
+inline std::size_t parse_digits_sse2(const char* text, std::size_t length, std::uint8_t* digits) {
+    constexpr auto ranges = make_digit_ranges<RADIX>();
+    std::size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        __m128i valid = _mm_setzero_si128();
+        __m128i value = _mm_setzero_si128();
+        for (const auto& range : ranges) {
+            const __m128i offset = _mm_sub_epi8(c, _mm_set1_epi8(static_cast<char>(range.first)));
+            const __m128i limit = _mm_set1_epi8(static_cast<char>(range.length - 1));
+            const __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(offset, limit), offset);
+            const __m128i digit = _mm_add_epi8(offset, _mm_set1_epi8(static_cast<char>(range.digit)));
+            valid = _mm_or_si128(valid, in);
+            value = _mm_or_si128(value, _mm_and_si128(in, digit));
+        }
+        if (_mm_movemask_epi8(valid) != 0xFFFF) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(digits + i), value);
+    }
+    return i;
+}
+#endif
+
+}// namespace impl
+
+/*
+ * parse_digits (Runtime text; returns the index of the first invalid character, or text.size())
+ *
+ * Constant evaluation uses the parse_digit tables, runtime uses the AVX2 or
+ * SSE2 kernels for whole blocks and the tables for the tail.
+ */
+template<std::uint8_t RADIX = 10, typename V = std::uint8_t>
+constexpr std::size_t parse_digits(std::string_view text, V* digits) {
+    std::size_t i = 0;
+    if constexpr (std::is_same<V, std::uint8_t>::value) {
+        if (!impl::is_constant_evaluated()) {
+#if defined(__AVX2__)
+            i += impl::parse_digits_avx2<RADIX>(text.data() + i, text.size() - i, digits + i);
+#endif
+#if defined(__SSE2__)
+            i += impl::parse_digits_sse2<RADIX>(text.data() + i, text.size() - i, digits + i);
+#endif
+        }
+    }
+    for (; i < text.size(); ++i) {
+        if (!is_digit<RADIX>(text[i])) {
+            return i;
+        }
+        digits[i] = parse_digit<RADIX, V>(text[i]);
+    }
+    return text.size();
+}
+
 /*
  * parse_digits
  */
@@ -300,6 +473,7 @@ constexpr auto parse_digits(const char (&text)[INPUT_LENGTH]) {
  */
 template<char... DIGITS, typename V = std::uint8_t>
 constexpr auto parse_digits_base2() {
+    static_assert((is_digit<2>(DIGITS) && ...), "invalid base 2 digit in literal");
     std::array<V, sizeof...(DIGITS)> digits = { DIGITS... };
     for (std::size_t i = 0; i < sizeof...(DIGITS); ++i) {
         digits[i] = parse_digit<2>(digits[i]);
@@ -312,6 +486,7 @@ constexpr auto parse_digits_base2() {
  */
 template<char... DIGITS, typename V = std::uint8_t>
 constexpr auto parse_digits_base8() {
+    static_assert((is_digit<8>(DIGITS) && ...), "invalid base 8 digit in literal");
     std::array<V, sizeof...(DIGITS)> digits = { DIGITS... };
     for (std::size_t i = 0; i < sizeof...(DIGITS); ++i) {
         digits[i] = parse_digit<8>(digits[i]);
@@ -324,6 +499,7 @@ constexpr auto parse_digits_base8() {
  */
 template<char... DIGITS, typename V = std::uint8_t>
 constexpr auto parse_digits_base10() {
+    static_assert((is_digit<10>(DIGITS) && ...), "invalid base 10 digit in literal");
     std::array<V, sizeof...(DIGITS)> digits = { DIGITS... };
     for (std::size_t i = 0; i < sizeof...(DIGITS); ++i) {
         digits[i] = parse_digit<10>(digits[i]);
@@ -337,6 +513,7 @@ constexpr auto parse_digits_base10() {
 template<char OH, char EX, char... DIGITS, typename V = std::uint8_t,
 typename = std::enable_if_t<OH == '0' && EX == 'x'>>
 constexpr auto parse_digits_base16() {
+    static_assert((is_digit<16>(DIGITS) && ...), "invalid base 16 digit in literal");
     std::array<V, sizeof...(DIGITS)> digits = { DIGITS... };
     for (std::size_t i = 0; i < sizeof...(DIGITS); ++i) {
         digits[i] = parse_digit<16>(digits[i]);
@@ -349,6 +526,7 @@ constexpr auto parse_digits_base16() {
  */
 template<char... DIGITS, typename V = std::uint8_t>
 constexpr auto parse_digits_base64() {
+    static_assert((is_digit<64>(DIGITS) && ...), "invalid base 64 digit in literal");
     std::array<V, sizeof...(DIGITS)> digits = { DIGITS... };
     for (std::size_t i = 0; i < sizeof...(DIGITS); ++i) {
         digits[i] = parse_digit<64>(digits[i]);
@@ -415,6 +593,12 @@ constexpr auto to_digits(const T v) {
 static_assert(numbers::parse_digit<2>('0') == 0, "parse_digit<2>('0')");
 static_assert(numbers::parse_digit<2>('1') == 1, "parse_digit<2>('1')");
 
+/*
+ * compose_digit (Base 2)
+ */
+static_assert(numbers::compose_digit<2>(0) == '0', "compose_digit<2>(0)");
+static_assert(numbers::compose_digit<2>(1) == '1', "compose_digit<2>(1)");
+
 /*
  * parse_digit (Base 8)
  */
@@ -655,6 +839,25 @@ static_assert(numbers::compose_digit<64>(61) == '9', "compose_digit<64>(61)");
 static_assert(numbers::compose_digit<64>(62) == '+', "compose_digit<64>(62)");
 static_assert(numbers::compose_digit<64>(63) == '/', "compose_digit<64>(63)");
 
+/*
+ * is_digit
+ */
+static_assert(numbers::is_digit<2>('1'), "is_digit<2>('1')");
+static_assert(!numbers::is_digit<2>('2'), "!is_digit<2>('2')");
+static_assert(numbers::is_digit<8>('0'), "is_digit<8>('0')");
+static_assert(!numbers::is_digit<8>('8'), "!is_digit<8>('8')");
+static_assert(numbers::is_digit('0'), "is_digit('0')");
+static_assert(numbers::is_digit('9'), "is_digit('9')");
+static_assert(!numbers::is_digit('a'), "!is_digit('a')");
+static_assert(!numbers::is_digit(' '), "!is_digit(' ')");
+static_assert(!numbers::is_digit('\xB0'), "!is_digit('\\xB0')");
+static_assert(numbers::is_digit<16>('f'), "is_digit<16>('f')");
+static_assert(numbers::is_digit<16>('F'), "is_digit<16>('F')");
+static_assert(!numbers::is_digit<16>('g'), "!is_digit<16>('g')");
+static_assert(numbers::is_digit<64>('A'), "is_digit<64>('A')");
+static_assert(numbers::is_digit<64>('/'), "is_digit<64>('/')");
+static_assert(!numbers::is_digit<64>('='), "!is_digit<64>('=')");
+
 /*
  * parse_digits
  */
@@ -669,6 +872,38 @@ static_assert(numbers::parse_digits("1234567890")[7] == 8, "parse_digits(\"12345
 static_assert(numbers::parse_digits("1234567890")[8] == 9, "parse_digits(\"1234567890\")[8]");
 static_assert(numbers::parse_digits("1234567890")[9] == 0, "parse_digits(\"1234567890\")[9]");
 
+/*
+ * make_digit_ranges
+ */
+static_assert(numbers::impl::make_digit_ranges<2>().size() == 1);
+static_assert(numbers::impl::make_digit_ranges<10>().size() == 1);
+static_assert(numbers::impl::make_digit_ranges<10>()[0].first == '0');
+static_assert(numbers::impl::make_digit_ranges<10>()[0].length == 10);
+static_assert(numbers::impl::make_digit_ranges<16>().size() == 3);
+static_assert(numbers::impl::make_digit_ranges<16>()[1].first == 'A');
+static_assert(numbers::impl::make_digit_ranges<16>()[1].digit == 10);
+static_assert(numbers::impl::make_digit_ranges<64>().size() == 5);
+static_assert(numbers::impl::make_digit_ranges<64>()[0].first == '+');
+static_assert(numbers::impl::make_digit_ranges<64>()[0].digit == 62);
+static_assert(numbers::impl::make_digit_ranges<64>()[3].length == 26);
+
+/*
+ * parse_digits (Runtime text)
+ */
+static_assert([] {
+    std::array<std::uint8_t, 4> digits = {};
+    return numbers::parse_digits<16>("fF09", digits.data()) == 4 &&
+        digits[0] == 15 && digits[1] == 15 && digits[2] == 0 && digits[3] == 9;
+}());
+static_assert([] {
+    std::array<std::uint8_t, 4> digits = {};
+    return numbers::parse_digits("12a4", digits.data()) == 2;
+}());
+static_assert([] {
+    std::array<std::uint8_t, 4> digits = {};
+    return numbers::parse_digits<64>("Zz[", digits.data()) == 2 && digits[1] == 51;
+}());
+
 /*
  * compose_digits
  */
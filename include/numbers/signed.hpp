@@ -0,0 +1,449 @@
+#ifndef NUMBERS_SIGNED_HH
+#define NUMBERS_SIGNED_HH
+
+#include "bigint.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace numbers {
+
+/*
+ * sbigint (Signed integer as a sign and a BITS-bit magnitude)
+ *
+ * Sign-magnitude rather than two's complement, so multiplication, division
+ * and radix conversion run the unsigned kernels on the magnitude unchanged
+ * and only the sign is worked out alongside. The range is symmetric,
+ * -(2^BITS - 1) to 2^BITS - 1, and zero is never negative.
+ */
+template<
+    std::size_t BITS = impl::default_bits<std::size_t>::value,
+    typename T = std::uint32_t
+>
+class sbigint {
+public:
+    typedef T limb_type;
+    static constexpr std::size_t bits = BITS;
+
+    constexpr sbigint() = default;
+
+    template<std::size_t OTHER_BITS, typename = std::enable_if_t<(OTHER_BITS <= BITS)>>
+    constexpr sbigint(const bigint<OTHER_BITS, T>& source, bool sign = false) :
+        value(of<T, OTHER_BITS, BITS>(source)),
+        negative(sign && source.used_limbs() != 0)
+    {}
+
+    template<std::size_t OTHER_BITS, typename = std::enable_if_t<(OTHER_BITS < BITS)>>
+    constexpr sbigint(const sbigint<OTHER_BITS, T>& other) :
+        sbigint(other.magnitude(), other.is_negative())
+    {}
+
+    constexpr const bigint<BITS, T>& magnitude() const {
+        return value;
+    }
+
+    constexpr bool is_negative() const {
+        return negative;
+    }
+
+    /*
+     * signum (-1, 0 or 1 as the value is negative, zero or positive)
+     */
+    constexpr int signum() const {
+        return negative ? -1 : (value.used_limbs() != 0 ? 1 : 0);
+    }
+
+private:
+    bigint<BITS, T> value = {};
+    bool negative = false;
+};
+
+namespace impl {
+
+/*
+ * signed_sum (Adds the magnitudes for equal signs, otherwise subtracts the smaller from the larger)
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr sbigint<required_bits_addition<T, A_BITS, B_BITS>::value, T> signed_sum(
+    const bigint<A_BITS, T>& a, bool a_negative, const bigint<B_BITS, T>& b, bool b_negative) {
+    if (a_negative == b_negative) {
+        return { add(a, b), a_negative };
+    }
+    if (compare(a, b) >= 0) {
+        return { subtract(a, b), a_negative };
+    }
+    return { subtract(b, a), b_negative };
+}
+
+} //namespace impl
+
+/*
+ * of (The low BITS bits of the magnitude, keeping the sign)
+ */
+template<std::size_t OUTPUT_BITS, std::size_t BITS, typename T>
+constexpr sbigint<OUTPUT_BITS, T> of(const sbigint<BITS, T>& a) {
+    bigint<OUTPUT_BITS, T> value = {  };
+    for (std::size_t i = 0; i < a.magnitude().count && i < value.count; i++) {
+        value[i] = a.magnitude()[i];
+    }
+    value[value.count - 1] = static_cast<T>(value[value.count - 1] & impl::top_limb_mask<T, OUTPUT_BITS>::value);
+    return { value, a.is_negative() };
+}
+
+/*
+ * negate (-)
+ */
+template<std::size_t BITS, typename T>
+constexpr sbigint<BITS, T> negate(const sbigint<BITS, T>& a) {
+    return { a.magnitude(), !a.is_negative() };
+}
+
+/*
+ * absolute_value (||)
+ */
+template<std::size_t BITS, typename T>
+constexpr sbigint<BITS, T> absolute_value(const sbigint<BITS, T>& a) {
+    return { a.magnitude() };
+}
+
+/*
+ * add
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto add(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return impl::signed_sum(a.magnitude(), a.is_negative(), b.magnitude(), b.is_negative());
+}
+
+/*
+ * subtract (Widened like add, so the difference never wraps)
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto subtract(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return impl::signed_sum(a.magnitude(), a.is_negative(), b.magnitude(), !b.is_negative());
+}
+
+/*
+ * multiply
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto multiply(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return sbigint<impl::required_bits_multiplication<T, A_BITS, B_BITS>::value, T>(
+        multiply(a.magnitude(), b.magnitude()), a.is_negative() != b.is_negative());
+}
+
+/*
+ * divmod (Quotient truncated toward zero and remainder with the sign of a, b must be non-zero)
+ *
+ * Matches the built-in signed types: a == quotient * b + remainder, with
+ * |remainder| < |b|.
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto divmod(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    const auto magnitudes = divmod(a.magnitude(), b.magnitude());
+    return divmod_result<sbigint<A_BITS, T>, sbigint<B_BITS, T>>{
+        { magnitudes.quotient, a.is_negative() != b.is_negative() },
+        { magnitudes.remainder, a.is_negative() }
+    };
+}
+
+/*
+ * divide
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto divide(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return divmod(a, b).quotient;
+}
+
+/*
+ * modulo
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto modulo(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return divmod(a, b).remainder;
+}
+
+/*
+ * '+', '-', '*', '/' and '%' (Arithmetic Operators)
+ */
+template<std::size_t BITS, typename T>
+constexpr sbigint<BITS, T> operator-(const sbigint<BITS, T>& a) {
+    return negate(a);
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto operator+(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return add(a, b);
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto operator-(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return subtract(a, b);
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto operator*(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return multiply(a, b);
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto operator/(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return divide(a, b);
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr auto operator%(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return modulo(a, b);
+}
+
+/*
+ * '+=', '-=' and '*=' (Compound Operators, the magnitude wrapping modulo 2^BITS)
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr sbigint<A_BITS, T>& operator+=(sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    a = of<A_BITS>(add(a, b));
+    return a;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr sbigint<A_BITS, T>& operator-=(sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    a = of<A_BITS>(subtract(a, b));
+    return a;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr sbigint<A_BITS, T>& operator*=(sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    bigint<A_BITS, T> value = a.magnitude();
+    value *= b.magnitude();
+    value[value.count - 1] = static_cast<T>(value[value.count - 1] & impl::top_limb_mask<T, A_BITS>::value);
+    a = { value, a.is_negative() != b.is_negative() };
+    return a;
+}
+
+/*
+ * '<<' and '>>' (Arithmetic Shift Operators)
+ *
+ * A left shift scales the magnitude, wrapping modulo 2^BITS. A right shift
+ * rounds toward negative infinity like the built-in signed types, so a
+ * negative value that loses set bits moves one further from zero.
+ */
+template<std::size_t BITS, typename T>
+constexpr sbigint<BITS, T> operator<<(const sbigint<BITS, T>& a, std::size_t shift) {
+    return { a.magnitude() << shift, a.is_negative() };
+}
+
+template<std::size_t BITS, typename T>
+constexpr sbigint<BITS, T> operator>>(const sbigint<BITS, T>& a, std::size_t shift) {
+    bigint<BITS, T> value = a.magnitude() >> shift;
+    const std::size_t lowest = a.magnitude().lowest_bit();
+    if (a.is_negative() && lowest != 0 && lowest <= shift) {
+        ++value;
+    }
+    return { value, a.is_negative() };
+}
+
+/*
+ * compare (Three-way comparison: negative, zero or positive as a < b, a == b or a > b)
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr int compare(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    if (a.is_negative() != b.is_negative()) {
+        return a.is_negative() ? -1 : 1;
+    }
+    const int magnitudes = compare(a.magnitude(), b.magnitude());
+    return a.is_negative() ? -magnitudes : magnitudes;
+}
+
+/*
+ * '==', '!=', '<', '<=', '>' and '>=' (Comparison Operators)
+ */
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator==(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return compare(a, b) == 0;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator!=(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return compare(a, b) != 0;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator<(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return compare(a, b) < 0;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator<=(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return compare(a, b) <= 0;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator>(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return compare(a, b) > 0;
+}
+
+template<typename T, std::size_t A_BITS, std::size_t B_BITS>
+constexpr bool operator>=(const sbigint<A_BITS, T>& a, const sbigint<B_BITS, T>& b) {
+    return compare(a, b) >= 0;
+}
+
+/*
+ * parse_signed (Runtime text to sbigint, an optional '+' or '-' then the digits parse accepts)
+ *
+ * Errors are reported as by parse, with position counting the sign.
+ */
+template<std::size_t BITS = impl::default_bits<std::size_t>::value, typename T = std::uint32_t, std::uint8_t RADIX = 10>
+constexpr parse_result<sbigint<BITS, T>> parse_signed(std::string_view text) {
+    const bool sign = !text.empty() && (text[0] == '-' || text[0] == '+');
+    const bool negative = sign && text[0] == '-';
+    const auto magnitude = parse<BITS, T, RADIX>(text.substr(sign ? 1 : 0));
+    return { { magnitude.value, negative }, magnitude.error, magnitude.position + (sign ? 1 : 0) };
+}
+
+/*
+ * to_string (Most significant digit first, '-' before negative values)
+ */
+template<std::uint8_t RADIX = 10, typename T, std::size_t BITS>
+std::string to_string(const sbigint<BITS, T>& v) {
+    std::string digits = to_string<RADIX>(v.magnitude());
+    if (v.is_negative()) {
+        digits.insert(digits.begin(), '-');
+    }
+    return digits;
+}
+
+} //namespace numbers
+
+namespace std {
+
+/*
+ * hash (The magnitude's hash, complemented for negative values)
+ */
+template<std::size_t BITS, typename T>
+struct hash<::numbers::sbigint<BITS, T>> {
+    std::size_t operator()(const ::numbers::sbigint<BITS, T>& value) const noexcept {
+        const std::size_t h = hash<::numbers::bigint<BITS, T>>{}(value.magnitude());
+        return value.is_negative() ? ~h : h;
+    }
+};
+
+} //namespace std
+
+/*
+ * sbigint
+ */
+static_assert(numbers::sbigint<16, std::uint8_t>::bits == 16);
+static_assert(numbers::sbigint<16, std::uint8_t>().signum() == 0);
+static_assert(numbers::sbigint<16, std::uint8_t>(numbers::bigint<8, std::uint8_t>{5}, true).signum() == -1);
+static_assert(!numbers::sbigint<16, std::uint8_t>(numbers::bigint<8, std::uint8_t>{0}, true).is_negative());
+static_assert(numbers::sbigint<16, std::uint8_t>(numbers::sbigint<8, std::uint8_t>(numbers::bigint<8, std::uint8_t>{5}, true)).is_negative());
+
+/*
+ * negate / absolute_value
+ */
+static_assert(numbers::negate(numbers::sbigint<8, std::uint8_t>(numbers::bigint<8, std::uint8_t>{5})).is_negative());
+static_assert(!numbers::negate(numbers::sbigint<8, std::uint8_t>()).is_negative());
+static_assert(!numbers::absolute_value(-numbers::sbigint<8, std::uint8_t>(numbers::bigint<8, std::uint8_t>{5})).is_negative());
+
+/*
+ * add / subtract
+ */
+static_assert([] {
+    const numbers::sbigint<8, std::uint8_t> a(numbers::bigint<8, std::uint8_t>{200});
+    const numbers::sbigint<8, std::uint8_t> b(numbers::bigint<8, std::uint8_t>{100}, true);
+    const auto sum = a + b;
+    const auto difference = b - a;
+    const auto zero = a - a;
+    return sum.bits == 9 && sum.magnitude()[0] == 100 && !sum.is_negative()
+        && difference.magnitude()[0] == 44 && difference.magnitude()[1] == 1 && difference.is_negative()
+        && zero.signum() == 0 && (b + b).magnitude()[0] == 200 && (b + b).is_negative();
+}());
+
+/*
+ * multiply / divmod (Truncated toward zero, remainder with the sign of the dividend)
+ */
+static_assert([] {
+    const numbers::bigint<8, std::uint8_t> seven = {7};
+    const numbers::bigint<8, std::uint8_t> two = {2};
+    const numbers::sbigint<8, std::uint8_t> a(seven, true);
+    const numbers::sbigint<8, std::uint8_t> b(two);
+    const auto product = a * b;
+    const auto qr = numbers::divmod(a, b);
+    const auto qr_negative = numbers::divmod(a, -b);
+    return product.bits == 16 && product.magnitude()[0] == 14 && product.is_negative()
+        && qr.quotient.magnitude()[0] == 3 && qr.quotient.is_negative()
+        && qr.remainder.magnitude()[0] == 1 && qr.remainder.is_negative()
+        && qr_negative.quotient.magnitude()[0] == 3 && !qr_negative.quotient.is_negative()
+        && qr_negative.remainder.is_negative() && (a * a).magnitude()[0] == 49 && !(a * a).is_negative();
+}());
+
+/*
+ * '+=', '-=', '*='
+ */
+static_assert([] {
+    numbers::sbigint<8, std::uint8_t> a(numbers::bigint<8, std::uint8_t>{10});
+    const numbers::sbigint<8, std::uint8_t> b(numbers::bigint<8, std::uint8_t>{25}, true);
+    a += b;
+    const bool negative = a.is_negative() && a.magnitude()[0] == 15;
+    a -= b;
+    const bool positive = !a.is_negative() && a.magnitude()[0] == 10;
+    a *= b;
+    return negative && positive && a.is_negative() && a.magnitude()[0] == 250;
+}());
+static_assert([] {
+    numbers::sbigint<12, std::uint8_t> a(numbers::bigint<12, std::uint8_t>{100}, true);
+    a *= a;
+    return !a.is_negative() && a.magnitude()[0] == 0x10 && a.magnitude()[1] == 0x07;
+}());
+
+/*
+ * '<<' and '>>' (Arithmetic Shifts)
+ */
+static_assert([] {
+    const numbers::sbigint<16, std::uint8_t> a(numbers::bigint<16, std::uint8_t>{7}, true);
+    const numbers::sbigint<16, std::uint8_t> b(numbers::bigint<16, std::uint8_t>{8}, true);
+    return (a >> 1).magnitude()[0] == 4 && (b >> 1).magnitude()[0] == 4 && (b >> 3).magnitude()[0] == 1
+        && (b >> 4).magnitude()[0] == 1 && (b >> 40).magnitude()[0] == 1 && (b >> 40).is_negative()
+        && (-a >> 1).magnitude()[0] == 3 && (-a >> 40).signum() == 0
+        && (a << 9).magnitude()[1] == 14 && (a << 9).is_negative();
+}());
+
+/*
+ * compare and relational operators
+ */
+static_assert([] {
+    const numbers::sbigint<16, std::uint8_t> a(numbers::bigint<16, std::uint8_t>{1, 2}, true);
+    const numbers::sbigint<8, std::uint8_t> b(numbers::bigint<8, std::uint8_t>{9}, true);
+    const numbers::sbigint<8, std::uint8_t> zero;
+    return a < b && b < zero && zero < -b && -b < -a && a <= a && -a >= b && a != b && a == a
+        && numbers::compare(a, b) < 0 && numbers::compare(-a, -b) > 0 && numbers::compare(zero, -zero) == 0;
+}());
+
+/*
+ * parse_signed
+ */
+static_assert(numbers::parse_signed<64, std::uint32_t>("-1234567890").value.is_negative());
+static_assert(numbers::parse_signed<64, std::uint32_t>("-1234567890").value.magnitude()[0] == 1234567890);
+static_assert(!numbers::parse_signed<64, std::uint32_t>("+42").value.is_negative());
+static_assert(numbers::parse_signed<64, std::uint32_t>("+42").value.magnitude()[0] == 42);
+static_assert(!numbers::parse_signed<64, std::uint32_t>("-0").value.is_negative());
+static_assert(numbers::parse_signed<64, std::uint32_t>("-").error == std::errc::invalid_argument);
+static_assert(numbers::parse_signed<64, std::uint32_t>("-").position == 1);
+static_assert(numbers::parse_signed<64, std::uint32_t>("-12x4").position == 3);
+static_assert(numbers::parse_signed<64, std::uint32_t, 16>("-FFFFFFFFFFFFFFFF").value.magnitude()[1] == 0xFFFFFFFF);
+static_assert(numbers::parse_signed<64, std::uint32_t, 16>("-10000000000000000").error == std::errc::result_out_of_range);
+
+namespace numbers {
+static_assert([] {
+    constexpr sbigint<256> a(0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16, true);
+    constexpr sbigint<256> b(0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F_16);
+    const auto qr = divmod(a * b + b, b);
+    return qr.quotient == a + sbigint<256>(1_10) && qr.remainder.signum() == 0
+        && (a - b) + b == a && -(a - b) == b - a && (a - b) / (b - a) == -sbigint<256>(1_10);
+}());
+} //namespace numbers
+
+#endif//NUMBERS_SIGNED_HH
@@ -1,8 +1,18 @@
+#include <numbers/arena.hpp>
+#include <numbers/barrett.hpp>
 #include <numbers/bigint.hpp>
+#include <numbers/dynamic.hpp>
 #include <numbers/elementary.hpp>
+#include <numbers/expression.hpp>
+#include <numbers/field.hpp>
+#include <numbers/gcd.hpp>
+#include <numbers/montgomery.hpp>
+#include <numbers/prime.hpp>
 #include <numbers/radix.hpp>
+#include <numbers/signed.hpp>
 
 #include <iostream>
+#include <string>
 
 using namespace numbers;
 
@@ -28,12 +38,14 @@ static_assert(bigint512_b.highest_bit() == 512);
 template<size_t BITS, typename T>
 void print(bigint<BITS, T> a) {
     std::cout << std::endl;
-    std::cout << "Used Bits, Highest Bit, Elements" << std::endl << "(Underlying Value Array)" << std::endl;
+    std::cout << "Used Bits, Highest Bit, Elements" << std::endl << "(Underlying Value Array)" << std::endl << "(Base 10, Base 16)" << std::endl;
     std::cout << a.bits << "," << a.highest_bit() << "," << a.count << std::endl;
     for (size_t i = 0; i < a.count; i++) {
         std::cout << (a[i]) << ",";
     }
     std::cout << std::endl;
+    std::cout << to_string(a) << std::endl;
+    std::cout << "0x" << to_string<16>(a) << std::endl;
 }
 
 int main()
@@ -47,5 +59,71 @@ int main()
     print(bigint512_a);
     print(bigint512_b);
 
+    // Parse at runtime, reporting invalid characters and overflow
+    const std::string text = "115792089237316195423570985008687907853269984665640564039457584007913129639935";
+    const auto parsed = parse<256>(text);
+    if (parsed.error == std::errc{}) {
+        print(parsed.value);
+    }
+    if (parse<256>(text + "0").error == std::errc::result_out_of_range) {
+        std::cout << "Appending a digit overflows 256 bits" << std::endl;
+    }
+
+    // Modular exponentiation in Montgomery form: 2^(p - 1) = 1 mod p for p = 2^255 - 19
+    constexpr auto p25519 = 57896044618658097711785492504343953926634992332820282019728792003956564819949_10;
+    constexpr montgomery_context<256> field(p25519);
+    print(field.pow_mod({2}, subtract(p25519, bigint<32>{1})));
+
+    // Prime field with folding reduction: x * x^-1 = 1 in the secp256k1 field
+    typedef prime_field<secp256k1_modulus> secp256k1;
+    constexpr auto x = 0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16;
+    print(secp256k1::multiply(x, secp256k1::inverse(x)));
+
+    // A shift by a compile-time count widens the type to 256 + 64 bits
+    print(x << identity<std::size_t, 64>{});
+
+    // Accumulate x * x + x in place, without forming the product first
+    bigint<512> sum = {};
+    multiply_accumulate(sum, x, x);
+    sum += x;
+    print(sum);
+
+    // The same sum as an expression, evaluated once into a result of its final width
+    print(evaluate(lazy(x) * x + x));
+
+    // Three-way comparison, and hashing for unordered containers
+    std::cout << compare(x, bigint256_base16) << " " << std::hash<bigint<256>>{}(x) << std::endl;
+
+    // Integer logarithm and square root
+    std::cout << log10(bigint256_base10) << std::endl;
+    print(integer_sqrt(bigint256_base10));
+
+    // A runtime-sized value grows past 256 bits as needed, and converts back to a fixed width
+    auto grown = parse_dynamic(text).value;
+    grown *= grown;
+    std::cout << to_string(grown) << std::endl;
+    print(of<512>(grown));
+
+    // Temporaries of a * b + c come from an arena, and are all freed when the scope ends
+    limb_arena arena;
+    {
+        arena_scope scope(arena);
+        const auto a = parse_dynamic(text, arena_allocator<std::uint32_t>(arena)).value;
+        std::cout << to_string(a * a + a) << std::endl;
+    }
+
+    // Signed difference of two balances, and division truncated toward zero
+    const auto paid = parse_signed<256>("-" + text).value;
+    const sbigint<256> owed = x;
+    std::cout << to_string(owed + paid) << " " << to_string((owed + paid) / owed) << std::endl;
+
+    // Greatest common divisor and modular inverse by Lehmer's algorithm
+    print(gcd(multiply(x, bigint<32>{15}), bigint<32>{35}));
+    print(inverse_mod(x, secp256k1::modulus));
+
+    // Baillie-PSW primality and the next prime above x, sieved on two threads
+    std::cout << is_probable_prime(p25519) << std::endl;
+    print(next_prime(x, 2));
+
     return 0;
 }
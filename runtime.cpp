@@ -0,0 +1,227 @@
+#include <numbers/arena.hpp>
+#include <numbers/bigint.hpp>
+#include <numbers/dynamic.hpp>
+#include <numbers/prime.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <utility>
+
+using namespace numbers;
+
+// Runtime behaviour that static_assert cannot reach: threads, allocation and runtime-sized values.
+// Each failed check is reported, and the exit code is the number of failures.
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+/*
+ * next_prime (The threaded driver)
+ */
+void check_next_prime() {
+    constexpr auto x = 0x123456789ABCDEF0FEDCBA9876543210123456789ABCDEF0FEDCBA9876543210_16;
+    const auto single = next_prime(x, 1);
+    check(single > x && is_probable_prime(single), "next_prime is a prime above n");
+    check(next_prime(x, 2) == single, "next_prime on 2 threads matches 1 thread");
+    check(next_prime(x, 4) == single, "next_prime on 4 threads matches 1 thread");
+    check(next_prime(x, 7) == single, "next_prime on 7 threads matches 1 thread");
+
+    // Below the largest tabled prime the table answers
+    check(next_prime(bigint<32>{100}, 4) == bigint<32>{101}, "next_prime(100) == 101");
+    check(next_prime(bigint<8, std::uint8_t>{251}, 4) == bigint<8, std::uint8_t>{}, "no 8-bit prime above 251");
+
+    // 65521 and 2^64 - 59 are the largest primes of their width
+    check(next_prime(bigint<16, std::uint16_t>{65519}, 4) == bigint<16, std::uint16_t>{65521}, "next_prime(65519) == 65521");
+    check(next_prime(bigint<16, std::uint16_t>{65521}, 1) == bigint<16, std::uint16_t>{}, "no 16-bit prime above 65521");
+    check(next_prime(bigint<16, std::uint16_t>{65521}, 4) == bigint<16, std::uint16_t>{}, "no 16-bit prime above 65521 on 4 threads");
+    check(next_prime(bigint<64, std::uint64_t>{0xFFFFFFFFFFFFFFC5}, 1) == bigint<64, std::uint64_t>{}, "no 64-bit prime above 2^64 - 59");
+    check(next_prime(bigint<64, std::uint64_t>{0xFFFFFFFFFFFFFFC5}, 4) == bigint<64, std::uint64_t>{}, "no 64-bit prime above 2^64 - 59 on 4 threads");
+    check(next_prime(bigint<64, std::uint16_t>{0xFFC4, 0xFFFF, 0xFFFF, 0xFFFF}, 3) == bigint<64, std::uint16_t>{0xFFC5, 0xFFFF, 0xFFFF, 0xFFFF},
+        "next_prime(2^64 - 60) == 2^64 - 59 in 16-bit limbs");
+}
+
+/*
+ * random_bigint (A value with exactly used_bits significant bits)
+ */
+template<typename T, std::size_t BITS>
+bigint<BITS, T> random_bigint(std::mt19937_64& rng, std::size_t used_bits) {
+    bigint<BITS, T> value = {};
+    for (std::size_t bit = 0; bit + 1 < used_bits; ++bit) {
+        if (rng() & 1) {
+            value.set_bit(bit);
+        }
+    }
+    value.set_bit(used_bits - 1);
+    return value;
+}
+
+/*
+ * dynamic_bigint (Against the static_asserted bigint results)
+ */
+template<typename T>
+void check_dynamic() {
+    std::mt19937_64 rng(sizeof(T));
+    bigint<101, T> power = {};
+    power.set_bit(100);
+    for (std::size_t round = 0; round < 20; ++round) {
+        // a is always longer than b, and b spans several limbs for every limb type but the widest
+        const auto a = random_bigint<T, 1000>(rng, 1000 - round * 37);
+        const auto b = random_bigint<T, 600>(rng, 600 - round * 29);
+        const auto c = random_bigint<T, 64>(rng, 64 - round);
+        const auto da = to_dynamic(a);
+        const auto db = to_dynamic(b);
+        const auto dc = to_dynamic(c);
+
+        check(of<1000>(da) == a, "dynamic: to_dynamic and of round trip");
+        check(of<100>(da) == modulo(a, power), "dynamic: of keeps the low bits");
+        check(of<1001>(da + db) == add(a, b), "dynamic: a + b");
+        check(of<1000>(da - db) == subtract(a, b), "dynamic: a - b");
+        check(of<1600>(da * db) == multiply(a, b), "dynamic: a * b");
+        check(of<2000>(da * da) == square(a), "dynamic: a * a");
+
+        auto product = da;
+        product *= db;
+        check(of<1600>(product) == multiply(a, b), "dynamic: a *= b");
+        product = da;
+        product *= product;
+        check(of<2000>(product) == square(a), "dynamic: a *= a");
+
+        auto acc = dc;
+        multiply_accumulate(acc, da, db);
+        check(of<1601>(acc) == add(c, multiply(a, b)), "dynamic: multiply_accumulate(c, a, b)");
+        acc = da;
+        multiply_accumulate(acc, acc, db);
+        check(of<1601>(acc) == add(a, multiply(a, b)), "dynamic: multiply_accumulate(a, a, b)");
+        acc = db;
+        multiply_accumulate(acc, da, acc);
+        check(of<1601>(acc) == add(b, multiply(a, b)), "dynamic: multiply_accumulate(b, a, b)");
+        acc = da;
+        multiply_accumulate(acc, acc, acc);
+        check(of<2001>(acc) == add(a, square(a)), "dynamic: multiply_accumulate(a, a, a)");
+
+        const auto qr = divmod(da, db);
+        const auto expected = divmod(a, b);
+        check(of<1000>(qr.quotient) == expected.quotient && of<600>(qr.remainder) == expected.remainder, "dynamic: divmod(a, b)");
+        check(qr.quotient * db + qr.remainder == da && qr.remainder < db, "dynamic: a == q * b + r with r < b");
+        const auto qr_short = divmod(da, dc);
+        const auto expected_short = divmod(a, c);
+        check(of<1000>(qr_short.quotient) == expected_short.quotient && of<64>(qr_short.remainder) == expected_short.remainder,
+            "dynamic: divmod(a, c)");
+        const auto qr_larger = divmod(db, da);
+        check(qr_larger.quotient.size() == 0 && qr_larger.remainder == db, "dynamic: divmod(b, a) with b < a");
+
+        const std::size_t shift = 77 + round;
+        auto shifted = da;
+        shifted <<= shift;
+        check(of<1100>(shifted) == (of<T, 1000, 1100>(a) << shift), "dynamic: a <<= shift");
+        shifted >>= shift;
+        check(shifted == da, "dynamic: (a << shift) >>= shift");
+        check(of<1000>(da >> shift) == (a >> shift), "dynamic: a >> shift");
+
+        check(to_string<8>(da) == to_string<8>(a), "dynamic: to_string<8>");
+        check(to_string<10>(da) == to_string<10>(a), "dynamic: to_string<10>");
+        check(to_string<16>(da) == to_string<16>(a), "dynamic: to_string<16>");
+        check(parse_dynamic<T, 8>(to_string<8>(a)).value == da, "dynamic: parse_dynamic<8>");
+        check(parse_dynamic<T, 10>(to_string<10>(a)).value == da, "dynamic: parse_dynamic<10>");
+        check(parse_dynamic<T, 16>(to_string<16>(a)).value == da, "dynamic: parse_dynamic<16>");
+    }
+}
+
+/*
+ * dynamic_bigint divmod (Quotient estimates one too large, taking the add-back step)
+ */
+void check_dynamic_add_back() {
+    const char* cases[][4] = {
+        { "B08C2CB3577755", "BB89D84C", "F0FF30", "73CB3515" },
+        { "DD51C661E8303B", "E3B2CCCF", "F8D3FF", "CB77910A" },
+    };
+    for (const auto& values : cases) {
+        const auto u = parse_dynamic<std::uint8_t, 16>(values[0]).value;
+        const auto v = parse_dynamic<std::uint8_t, 16>(values[1]).value;
+        const auto qr = divmod(u, v);
+        check(to_string<16>(qr.quotient) == values[2] && to_string<16>(qr.remainder) == values[3], "dynamic: divmod add-back");
+        const auto expected = divmod(of<56>(u), of<32>(v));
+        check(of<56>(qr.quotient) == expected.quotient && of<32>(qr.remainder) == expected.remainder, "dynamic: divmod add-back matches bigint");
+    }
+}
+
+/*
+ * limb_arena, arena_scope and arena_bigint
+ */
+void check_arena() {
+    typedef arena_allocator<std::uint32_t> allocator;
+    auto same = [](limb_arena::mark a, limb_arena::mark b) {
+        return a.block == b.block && a.offset == b.offset;
+    };
+
+    limb_arena arena(4096);
+    const auto start = arena.position();
+    void* first = arena.allocate(64, 8);
+    const auto after_first = arena.position();
+    void* second = arena.allocate(64, 8);
+    const auto after_second = arena.position();
+    arena.deallocate(first, 64);
+    check(same(arena.position(), after_second), "arena: freeing an older allocation is deferred");
+    arena.deallocate(second, 64);
+    check(same(arena.position(), after_first), "arena: freeing the newest allocation rewinds");
+    arena.rewind(start);
+    check(same(arena.position(), start), "arena: rewind to a mark");
+
+    {
+        arena_scope scope(arena);
+        arena.allocate(10000, 8);
+        check(!same(arena.position(), start), "arena: allocations inside a scope advance");
+    }
+    check(same(arena.position(), start), "arena: arena_scope rewinds on exit");
+
+    // A repeated batch reuses the blocks of the first pass
+    std::mt19937_64 rng(23);
+    const auto x = random_bigint<std::uint32_t, 20000>(rng, 20000);
+    const auto expected = to_dynamic(x) * to_dynamic(x) + to_dynamic(x);
+    std::size_t reserved = 0;
+    for (int pass = 0; pass < 8; ++pass) {
+        arena_scope scope(arena);
+        const auto a = to_dynamic(x, allocator(arena));
+        const auto result = a * a + a;
+        check(to_string<16>(result) == to_string<16>(expected), "arena: a * a + a matches the default allocator");
+        if (pass == 0) {
+            reserved = arena.reserved();
+        }
+        check(arena.reserved() == reserved, "arena: reserved() stays flat across scoped batches");
+    }
+    check(reserved > 0 && same(arena.position(), start), "arena: batches leave the arena rewound");
+
+    // A move steals the limbs on the same arena and copies across arenas
+    limb_arena other;
+    auto source = to_dynamic(x, allocator(arena));
+    const std::uint32_t* limbs = source.data();
+    arena_bigint<> stolen{ allocator(arena) };
+    stolen = std::move(source);
+    check(stolen.data() == limbs && of<20000>(stolen) == x, "arena: a move on the same arena takes the limbs");
+    arena_bigint<> copied{ allocator(other) };
+    copied = std::move(stolen);
+    check(copied.data() != limbs && copied.get_allocator().arena == &other && of<20000>(copied) == x,
+        "arena: a move across arenas copies into the target arena");
+}
+
+int main()
+{
+    check_next_prime();
+    check_dynamic<std::uint8_t>();
+    check_dynamic<std::uint16_t>();
+    check_dynamic<std::uint32_t>();
+    check_dynamic<std::uint64_t>();
+    check_dynamic_add_back();
+    check_arena();
+    if (failures != 0) {
+        std::cerr << failures << " checks failed" << std::endl;
+    }
+    return failures;
+}